@@ -0,0 +1,36 @@
+import time
+from pathlib import Path
+
+import pytest
+
+DATA_DIR = Path(__file__).parent.parent / 'tests' / 'data'
+
+
+def pytest_addoption(parser):
+    parser.addoption('--bench-data', action='store', default=None,
+                     help='Directory of GRIB2 files to benchmark in addition '
+                          'to the bundled reference files (see '
+                          'benchmarks/make_synthetic.py).')
+
+
+@pytest.fixture
+def bench_data(request):
+    """Optional directory of large benchmark files, or None."""
+    path = request.config.getoption('--bench-data')
+    return None if path is None else Path(path)
+
+
+try:
+    import pytest_benchmark  # noqa: F401
+except(ImportError):
+    # Minimal stand-in for the pytest-benchmark fixture so the scenarios
+    # stay runnable as plain tests: time a single call and report it.
+    @pytest.fixture
+    def benchmark(request):
+        def run(func, *args, **kwargs):
+            t0 = time.perf_counter()
+            result = func(*args, **kwargs)
+            elapsed = time.perf_counter() - t0
+            print(f'\n{request.node.name}: {elapsed:.4f} s')
+            return result
+        return run
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""
+Generate a synthetic GRIB2 corpus for the benchmark suite.
+
+The bundled reference files under tests/data are small subsets; the
+index-build and select scenarios only show their scaling behavior on
+corpora of thousands of messages.  This script replicates a source file's
+messages many times per output file -- a concatenation of GRIB2 messages
+is itself a valid GRIB2 stream -- which exercises indexing and I/O at
+scale without shipping large binaries in the repository.
+
+Example:
+
+    python benchmarks/make_synthetic.py --copies 200 --files 8 /tmp/corpus
+    pytest benchmarks/ --bench-data /tmp/corpus
+"""
+
+import argparse
+from pathlib import Path
+
+DEFAULT_SOURCE = (Path(__file__).parent.parent / 'tests' / 'data' /
+                  'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset')
+
+
+def make_corpus(outdir: Path, source: Path, copies: int, files: int):
+    """Write `files` GRIB2 files, each `copies` concatenations of source."""
+    outdir.mkdir(parents=True, exist_ok=True)
+    raw = source.read_bytes()
+    for n in range(files):
+        outfile = outdir / f'synthetic_{n:03d}.grib2'
+        with open(outfile, 'wb') as f:
+            for _ in range(copies):
+                f.write(raw)
+        print(f'wrote {outfile} ({outfile.stat().st_size} bytes)')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('outdir', type=Path,
+                        help='directory to write the corpus into')
+    parser.add_argument('--source', type=Path, default=DEFAULT_SOURCE,
+                        help='GRIB2 file to replicate (default: bundled GFS subset)')
+    parser.add_argument('--copies', type=int, default=100,
+                        help='copies of the source per output file')
+    parser.add_argument('--files', type=int, default=4,
+                        help='number of output files')
+    args = parser.parse_args()
+    make_corpus(args.outdir, args.source, args.copies, args.files)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,77 @@
+"""Read-path benchmarks: index build, per-DRT decode, select, xarray."""
+
+from pathlib import Path
+
+import pytest
+
+import grib2io
+
+DATA_DIR = Path(__file__).parent.parent / 'tests' / 'data'
+GFS_SUBSET = DATA_DIR / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+
+# One reference file per packing scheme exercised by the decode
+# scenarios.
+DRT_FILES = {
+    'subset': GFS_SUBSET,
+    'complex': DATA_DIR / 'gfs.complex.grib2',
+    'jpeg': DATA_DIR / 'gfs.jpeg.grib2',
+    'png': DATA_DIR / 'gfs.png.grib2',
+}
+
+
+def _index_file(path):
+    with grib2io.open(path) as f:
+        return len(f)
+
+
+def test_index_build(benchmark):
+    """Index-build throughput over a bundled GFS subset."""
+    nmsgs = benchmark(_index_file, GFS_SUBSET)
+    assert nmsgs > 0
+
+
+def test_index_build_corpus(benchmark, bench_data):
+    """Index-build throughput over a synthetic corpus (--bench-data)."""
+    if bench_data is None:
+        pytest.skip('no --bench-data directory given')
+    files = sorted(bench_data.glob('*.grib2'))
+    if not files:
+        pytest.skip(f'no GRIB2 files in {bench_data}')
+    nmsgs = benchmark(lambda: sum(_index_file(f) for f in files))
+    assert nmsgs > 0
+
+
+@pytest.mark.parametrize('drt', sorted(DRT_FILES))
+def test_decode(benchmark, drt):
+    """Decode throughput for one packing scheme; unpack() skips caches."""
+    with grib2io.open(DRT_FILES[drt]) as f:
+        msg = f[0]
+        fld = benchmark(msg.unpack)
+    assert fld.shape == (msg.ny, msg.nx)
+
+
+def test_decode_all_messages(benchmark):
+    """Decode every message of a file through the open.data() batch path."""
+    with grib2io.open(GFS_SUBSET) as f:
+        msgs = f.select(productDefinitionTemplateNumber=0,
+                        typeOfFirstFixedSurface=1)
+        arr = benchmark(f.data, messages=msgs)
+    assert arr.shape[0] == len(msgs)
+
+
+def test_select(benchmark):
+    """select() over an already-built index."""
+    with grib2io.open(GFS_SUBSET) as f:
+        shortname = f[0].shortName
+        msgs = benchmark(f.select, shortName=shortname)
+    assert len(msgs) > 0
+
+
+def test_xarray_open_dataset(benchmark):
+    """xarray backend open (index parse plus variable construction)."""
+    xr = pytest.importorskip('xarray')
+    filters = dict(productDefinitionTemplateNumber=0,
+                   typeOfFirstFixedSurface=1)
+    ds = benchmark(xr.open_dataset, GFS_SUBSET, engine='grib2io',
+                   filters=filters)
+    assert len(ds.data_vars) > 0
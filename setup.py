@@ -56,6 +56,34 @@ def get_package_info(name, config, static=False):
             pkg_incdir = os.path.join(pkg_dir,'include')
     return (pkg_incdir, pkg_libdir)
 
+def check_openmp_support(flag='-fopenmp'):
+    """
+    Return True if the C compiler accepts `flag` and links a minimal
+    OpenMP program.  Setting the environment variable GRIB2IO_OPENMP to
+    '1' or '0' skips the probe and forces the result, e.g. for clang
+    setups where libomp needs extra flags.
+    """
+    import shlex
+    import tempfile
+    override = os.environ.get('GRIB2IO_OPENMP')
+    if override is not None:
+        return override not in {'0', 'False'}
+    cc = shlex.split(os.environ.get('CC', 'cc'))
+    src = ('#include <omp.h>\n'
+           'int main(void){return omp_get_max_threads() < 1;}\n')
+    with tempfile.TemporaryDirectory() as tmpdir:
+        srcfile = os.path.join(tmpdir, 'omp_probe.c')
+        with open(srcfile, 'w') as f:
+            f.write(src)
+        try:
+            cmd = subprocess.run(cc + [flag, srcfile, '-o',
+                                       os.path.join(tmpdir, 'omp_probe')],
+                                 stdout=subprocess.PIPE,
+                                 stderr=subprocess.PIPE)
+        except(OSError):
+            return False
+    return cmd.returncode == 0
+
 def find_library(name, dirs=None, static=False):
     _libext_by_platform = {"linux": ".so", "darwin": ".dylib"}
     out = []
@@ -114,6 +142,7 @@ libdirs = []
 from Cython.Distutils import build_ext
 cmdclass = {'build_ext': build_ext}
 redtoreg_pyx = 'src/ext/redtoreg.pyx'
+cmplxunpack_pyx = 'src/ext/cmplxunpack.pyx'
 g2clib_pyx  = 'src/ext/g2clib.pyx'
 
 # ----------------------------------------------------------------------------------------
@@ -190,9 +219,22 @@ g2clibext = Extension('grib2io.g2clib',
                       libraries = libraries,
                       runtime_library_dirs = libdirs,
                       extra_objects = extra_objects)
+# Build the redtoreg and cmplxunpack kernels with OpenMP when the C
+# compiler accepts -fopenmp (probed with a try-compile; override with
+# GRIB2IO_OPENMP=0/1) so their prange loops run in parallel; without
+# OpenMP the loops compile to serial code.
+openmp_args = ['-fopenmp'] if check_openmp_support() else []
+print(f'OpenMP support: {bool(openmp_args)}')
 redtoregext = Extension('grib2io.redtoreg',
                         [redtoreg_pyx],
-                        include_dirs = [numpy.get_include()])
+                        include_dirs = [numpy.get_include()],
+                        extra_compile_args = openmp_args,
+                        extra_link_args = openmp_args)
+cmplxunpackext = Extension('grib2io.cmplxunpack',
+                           [cmplxunpack_pyx],
+                           include_dirs = [numpy.get_include()],
+                           extra_compile_args = openmp_args,
+                           extra_link_args = openmp_args)
 
 # ----------------------------------------------------------------------------------------
 # Create __config__.py
@@ -220,7 +262,7 @@ with open(os.path.join(this_directory, 'README.md'), encoding='utf-8') as f:
 # ----------------------------------------------------------------------------------------
 # Run setup.py.  See pyproject.toml for package metadata.
 # ----------------------------------------------------------------------------------------
-setup(ext_modules = [g2clibext,redtoregext],
+setup(ext_modules = [g2clibext,redtoregext,cmplxunpackext],
       cmdclass = cmdclass,
       long_description = long_description,
       long_description_content_type = 'text/markdown')
@@ -0,0 +1,220 @@
+# cython: boundscheck=False, wraparound=False, cdivision=True
+"""
+Decoder for GRIB2 complex packing (Data Representation Templates 5.2 and
+5.3).
+
+The group structure of complex packing is naturally parallel: once the
+group reference values, widths, and lengths have been unpacked and the
+bit offset of each group's packed values is known, the groups can be
+expanded independently.  The group loop runs under OpenMP (a prange) when
+compiled with OpenMP support.  Fields using embedded missing value
+management and all other templates are decoded by the scalar g2c
+routines instead.
+"""
+from cython.parallel import prange
+import numpy as np
+cimport numpy as npc
+from libc.stdint cimport int64_t, uint32_t, uint64_t
+
+
+cdef inline uint64_t _gbits(const unsigned char[::1] buf, int64_t bitpos,
+                            int nbits) nogil:
+    """Extract nbits big-endian bits starting at bit position bitpos."""
+    cdef int64_t byte0 = bitpos >> 3
+    cdef int need = (<int>(bitpos & 7)) + nbits
+    cdef int n = (need + 7) >> 3
+    cdef uint64_t acc = 0
+    cdef int i
+    for i in range(n):
+        acc = (acc << 8) | buf[byte0+i]
+    acc >>= ((n << 3) - need)
+    return acc & (((<uint64_t>1) << nbits) - 1)
+
+
+cdef inline int64_t _gbits_signed(const unsigned char[::1] buf, int64_t bitpos,
+                                  int nbits) nogil:
+    """Extract a sign-and-magnitude encoded value of nbits bits."""
+    cdef uint64_t raw = _gbits(buf, bitpos, nbits)
+    cdef uint64_t mag = raw & ((((<uint64_t>1) << (nbits-1)) - 1))
+    if raw >> (nbits-1):
+        return -<int64_t>mag
+    return <int64_t>mag
+
+
+def unpack_complex(object gribmsg, object drtnin, object idrstmpl, object ndptsin):
+    """
+    Unpack a complex packed GRIB2 data section.
+
+    Only fields without embedded missing value management (template
+    position 7 equal to 0) are supported; a ValueError signals the caller
+    to fall back to the g2c decoder.
+
+    Parameters
+    ----------
+    gribmsg
+        Bytes of GRIB2 section 7 including the 5-byte section header.
+    drtnin
+        Data Representation Template number (2 or 3).
+    idrstmpl
+        Sequence containing the Data Representation Template.
+    ndptsin
+        Number of packed data points.
+
+    Returns
+    -------
+    unpack_complex
+        numpy.ndarray of dtype float32 and length ndpts.
+    """
+    cdef const unsigned char[::1] cgrib = gribmsg
+    cdef int drtn = drtnin
+    cdef int64_t ndpts = ndptsin
+
+    drt = np.asarray(idrstmpl, dtype=np.int64)
+    if drtn not in (2, 3):
+        raise ValueError("Data Representation Template must be 5.2 or 5.3.")
+    if drt[6] != 0:
+        raise ValueError("Missing value management is not supported.")
+
+    cdef uint32_t refbits = <uint32_t>(drt[0] & 0xffffffff)
+    cdef float rf = (<float*>&refbits)[0]
+    cdef double bscale = 2.0**drt[1]
+    cdef double dscale = 10.0**-drt[2]
+    cdef int nbitsgref = drt[3]
+    cdef int64_t ng = drt[9]
+    cdef int64_t refgwidth = drt[10]
+    cdef int nbitsgwidth = drt[11]
+    cdef int64_t refglen = drt[12]
+    cdef int64_t incglen = drt[13]
+    cdef int64_t lastglen = drt[14]
+    cdef int nbitsglen = drt[15]
+
+    if ng <= 0:
+        raise ValueError("Bad number of groups.")
+    if not 0 <= nbitsgref <= 32 or not 0 <= nbitsgwidth <= 32 or \
+       not 0 <= nbitsglen <= 32:
+        raise ValueError("Bad group field widths.")
+
+    # Bit position of the next unread value; the 5-byte section header is
+    # skipped.  The loops below run without bounds checking, so every
+    # block is validated against the buffer size before it is read.
+    cdef int64_t iofst = 5*8
+    cdef int64_t nbitsbuf = cgrib.shape[0]*8
+
+    # Spatial differencing descriptors (sign-and-magnitude encoded).
+    cdef int order = 0
+    cdef int nocts = 0
+    cdef int64_t ival1 = 0, ival2 = 0, minsd = 0
+    if drtn == 3:
+        order = drt[16]
+        nocts = drt[17]
+        if order not in (1, 2):
+            raise ValueError("Bad order of spatial differencing.")
+        if nocts < 0 or nocts > 7:
+            raise ValueError("Bad spatial differencing descriptor width.")
+        if iofst + (order+1)*nocts*8 > nbitsbuf:
+            raise ValueError("Section 7 is truncated.")
+        if nocts > 0:
+            ival1 = _gbits_signed(cgrib, iofst, nocts*8)
+            iofst += nocts*8
+            if order == 2:
+                ival2 = _gbits_signed(cgrib, iofst, nocts*8)
+                iofst += nocts*8
+            minsd = _gbits_signed(cgrib, iofst, nocts*8)
+            iofst += nocts*8
+
+    gref_arr = np.zeros(ng, dtype=np.int64)
+    gwidth_arr = np.zeros(ng, dtype=np.int64)
+    glen_arr = np.zeros(ng, dtype=np.int64)
+    cdef int64_t[::1] gref = gref_arr
+    cdef int64_t[::1] gwidth = gwidth_arr
+    cdef int64_t[::1] glen = glen_arr
+    cdef int64_t g
+
+    # Group reference values, padded out to a whole octet.
+    if nbitsgref != 0:
+        if iofst + nbitsgref*ng > nbitsbuf:
+            raise ValueError("Section 7 is truncated.")
+        with nogil:
+            for g in range(ng):
+                gref[g] = <int64_t>_gbits(cgrib, iofst+g*nbitsgref, nbitsgref)
+        iofst += nbitsgref*ng
+    iofst = (iofst+7) & ~<int64_t>7
+
+    # Group widths, padded out to a whole octet.
+    if nbitsgwidth != 0:
+        if iofst + nbitsgwidth*ng > nbitsbuf:
+            raise ValueError("Section 7 is truncated.")
+        with nogil:
+            for g in range(ng):
+                gwidth[g] = <int64_t>_gbits(cgrib, iofst+g*nbitsgwidth, nbitsgwidth)
+        iofst += nbitsgwidth*ng
+    iofst = (iofst+7) & ~<int64_t>7
+    gwidth_arr += refgwidth
+
+    # Scaled group lengths, padded out to a whole octet.
+    if nbitsglen != 0:
+        if iofst + nbitsglen*ng > nbitsbuf:
+            raise ValueError("Section 7 is truncated.")
+        with nogil:
+            for g in range(ng):
+                glen[g] = <int64_t>_gbits(cgrib, iofst+g*nbitsglen, nbitsglen)
+        iofst += nbitsglen*ng
+    iofst = (iofst+7) & ~<int64_t>7
+    glen_arr *= incglen
+    glen_arr += refglen
+    glen_arr[ng-1] = lastglen
+
+    if (glen_arr < 0).any() or glen_arr.sum() != ndpts:
+        raise ValueError("Group lengths do not sum to the number of data points.")
+    if gwidth_arr.min() < 0 or gwidth_arr.max() > 32:
+        raise ValueError("Bad group widths.")
+    if iofst + int((glen_arr*gwidth_arr).sum()) > nbitsbuf:
+        raise ValueError("Section 7 is truncated.")
+
+    # Output position and packed bit offset of each group.
+    opos_arr = np.zeros(ng, dtype=np.int64)
+    boff_arr = np.zeros(ng, dtype=np.int64)
+    np.cumsum(glen_arr[:-1], out=opos_arr[1:])
+    np.cumsum((glen_arr*gwidth_arr)[:-1], out=boff_arr[1:])
+    boff_arr += iofst
+
+    ifld_arr = np.empty(ndpts, dtype=np.int64)
+    cdef int64_t[::1] ifld = ifld_arr
+    cdef const int64_t[::1] opos = opos_arr
+    cdef const int64_t[::1] boff = boff_arr
+    cdef int64_t k, o, b, r
+    cdef int w
+
+    # Expand the groups; each group is independent.
+    for g in prange(ng, nogil=True, schedule='static'):
+        w = <int>gwidth[g]
+        r = gref[g]
+        o = opos[g]
+        b = boff[g]
+        if w == 0:
+            for k in range(glen[g]):
+                ifld[o+k] = r
+        else:
+            for k in range(glen[g]):
+                ifld[o+k] = r + <int64_t>_gbits(cgrib, b+k*w, w)
+
+    # Spatial differencing reconstruction (sequential by nature).
+    cdef int64_t n
+    if drtn == 3 and ndpts > order:
+        with nogil:
+            if order == 1:
+                ifld[0] = ival1
+                for n in range(1, ndpts):
+                    ifld[n] = ifld[n] + minsd + ifld[n-1]
+            else:
+                ifld[0] = ival1
+                ifld[1] = ival2
+                for n in range(2, ndpts):
+                    ifld[n] = ifld[n] + minsd + 2*ifld[n-1] - ifld[n-2]
+
+    # Scale to the field values.
+    fld_arr = np.empty(ndpts, dtype=np.float32)
+    cdef float[::1] fld = fld_arr
+    for n in prange(ndpts, nogil=True, schedule='static'):
+        fld[n] = <float>((rf + ifld[n]*bscale)*dscale)
+    return fld_arr
@@ -10,24 +10,18 @@ import math
 # Some helper definitions from the Python API
 # ----------------------------------------------------------------------------------------
 cdef extern from "Python.h":
-    # To access integers
-    object PyInt_FromLong(long)
-    long PyInt_AsLong(object)
-    # To access doubles
-    object PyFloat_FromDouble(double)
     # To access strings
     char * PyBytes_AsString(object string)
-    object PyBytes_FromString(char *s)
     object PyBytes_FromStringAndSize(char *s, size_t size)
-    int PyObject_AsWriteBuffer(object, void **rbuf, Py_ssize_t *len)
-    int PyObject_AsReadBuffer(object, void **rbuf, Py_ssize_t *len)
-    int PyObject_CheckReadBuffer(object)
 
 # ----------------------------------------------------------------------------------------
 # Definitions from std C libraries
 # ----------------------------------------------------------------------------------------
 cdef extern from "stdlib.h":
-    void free(void *ptr)
+    void free(void *ptr) nogil
+
+cdef extern from "string.h":
+    void *memcpy(void *dest, const void *src, size_t n) nogil
 
 # ----------------------------------------------------------------------------------------
 # Definitions from NCEPLIBS-g2c.
@@ -58,22 +52,22 @@ cdef extern from "grib2.h":
     cdef int G2_AEC_ENABLED
     ctypedef long g2int      # 64-bit signed integer
     ctypedef float g2float   # 32-bit floating-point
-    g2int g2_unpack1(unsigned char *,g2int *,g2int **,g2int *)
+    g2int g2_unpack1(unsigned char *,g2int *,g2int **,g2int *) nogil
     g2int g2_unpack3(unsigned char *,g2int *,g2int **,g2int **,
-                         g2int *,g2int **,g2int *)
+                         g2int *,g2int **,g2int *) nogil
     g2int g2_unpack4(unsigned char *,g2int *,g2int *,g2int **,
-                         g2int *,g2float **,g2int *)
-    g2int g2_unpack5(unsigned char *,g2int *,g2int *,g2int *, g2int **,g2int *)
-    g2int g2_unpack6(unsigned char *,g2int *,g2int ,g2int *, g2int **)
+                         g2int *,g2float **,g2int *) nogil
+    g2int g2_unpack5(unsigned char *,g2int *,g2int *,g2int *, g2int **,g2int *) nogil
+    g2int g2_unpack6(unsigned char *,g2int *,g2int ,g2int *, g2int **) nogil
     g2int g2_unpack7(unsigned char *,g2int *,g2int ,g2int *,
-                         g2int ,g2int *,g2int ,g2float **)
-    g2int g2_create(unsigned char *,g2int *,g2int *)
-    g2int g2_addlocal(unsigned char *,unsigned char *,g2int )
-    g2int g2_addgrid(unsigned char *,g2int *,g2int *,g2int *,g2int )
+                         g2int ,g2int *,g2int ,g2float **) nogil
+    g2int g2_create(unsigned char *,g2int *,g2int *) nogil
+    g2int g2_addlocal(unsigned char *,unsigned char *,g2int ) nogil
+    g2int g2_addgrid(unsigned char *,g2int *,g2int *,g2int *,g2int ) nogil
     g2int g2_addfield(unsigned char *,g2int ,g2int *,
                      g2float *,g2int ,g2int ,g2int *,
-                     g2float *,g2int ,g2int ,g2int *)
-    g2int g2_gribend(unsigned char *)
+                     g2float *,g2int ,g2int ,g2int *) nogil
+    g2int g2_gribend(unsigned char *) nogil
 
 __version__ = G2C_VERSION.decode("utf-8")[-5:]
 
@@ -88,29 +82,26 @@ cdef _toarray(void *items, object a):
     """
     Fill a numpy array from the grib2 file.  Note that this free()s the items argument!
     """
-    cdef void *abuf
-    cdef Py_ssize_t buflen
-    cdef g2int *idata
-    cdef int *idata32
-    cdef g2float *fdata
-
-    # Get pointer to data buffer.
-    PyObject_AsWriteBuffer(a, &abuf, &buflen)
+    cdef Py_ssize_t i, n
+    cdef g2int[::1] idata
+    cdef int[::1] idata32
+    cdef g2float[::1] fdata
 
+    n = len(a)
     if str(a.dtype) == "int32":
-      idata32 = <int *>abuf
+      idata32 = a
       # Fill buffer.
-      for i from 0 <= i < len(a):
+      for i in range(n):
         idata32[i] = (<int *>items)[i]
     elif str(a.dtype) == "int64":
-      idata = <g2int *>abuf
+      idata = a
       # Fill buffer.
-      for i from 0 <= i < len(a):
+      for i in range(n):
         idata[i] = (<g2int *>items)[i]
     elif str(a.dtype) == "float32":
-      fdata = <g2float *>abuf
+      fdata = a
       # Fill buffer.
-      for i from 0 <= i < len(a):
+      for i in range(n):
         fdata[i] = (<g2float *>items)[i]
     else:
       free(items)
@@ -159,12 +150,12 @@ def unpack1(gribmsg, ipos, object zeros):
     ERROR CODES:   2 = Array passed is not section 1
                    6 = Memory allocation error
     """
-    cdef unsigned char *cgrib
-    cdef g2int i, iofst, ierr, idslen
+    cdef const unsigned char[::1] cgrib = gribmsg
+    cdef g2int iofst, ierr, idslen
     cdef g2int *ids
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ierr = g2_unpack1(cgrib, &iofst, &ids, &idslen)
+    iofst = <g2int>(ipos*8)
+    with nogil:
+        ierr = g2_unpack1(<unsigned char *>&cgrib[0], &iofst, &ids, &idslen)
     if ierr != 0:
        msg = "Error unpacking section 1 - error code = %i" % ierr
        raise RuntimeError(msg)
@@ -208,14 +199,14 @@ def unpack3(gribmsg, ipos, object zeros):
                    5 = "GRIB" message contains an undefined Grid Definition Template.
                    6 = memory allocation error
     """
-    cdef unsigned char *cgrib
+    cdef const unsigned char[::1] cgrib = gribmsg
     cdef g2int *igds
     cdef g2int *igdstmpl
     cdef g2int *ideflist
     cdef g2int mapgridlen, iofst, idefnum, ierr
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ierr=g2_unpack3(cgrib,&iofst,&igds,&igdstmpl,&mapgridlen,&ideflist,&idefnum)
+    iofst = <g2int>(ipos*8)
+    with nogil:
+        ierr=g2_unpack3(<unsigned char *>&cgrib[0],&iofst,&igds,&igdstmpl,&mapgridlen,&ideflist,&idefnum)
     if ierr != 0:
        msg = "Error unpacking section 3 - error code = %i" % ierr
        raise RuntimeError(msg)
@@ -259,14 +250,14 @@ def unpack4(gribmsg,ipos,object zeros):
                      Template.
                  6 = Memory allocation error
     """
-    cdef unsigned char *cgrib
+    cdef const unsigned char[::1] cgrib = gribmsg
     cdef g2int *ipdstmpl
     cdef g2float *icoordlist
     cdef g2int mappdslen, iofst, ipdsnum, ierr, numcoord
     numcoord = 0
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ierr=g2_unpack4(cgrib,&iofst,&ipdsnum,&ipdstmpl,&mappdslen,&icoordlist,&numcoord)
+    iofst = <g2int>(ipos*8)
+    with nogil:
+        ierr=g2_unpack4(<unsigned char *>&cgrib[0],&iofst,&ipdsnum,&ipdstmpl,&mappdslen,&icoordlist,&numcoord)
     if ierr != 0:
        msg = "Error unpacking section 4 - error code = %i" % ierr
        raise RuntimeError(msg)
@@ -308,12 +299,12 @@ def unpack5(gribmsg,ipos,object zeros):
                  7 = "GRIB" message contains an undefined Data
                      Representation Template
     """
-    cdef unsigned char *cgrib
+    cdef const unsigned char[::1] cgrib = gribmsg
     cdef g2int *idrstmpl
     cdef g2int iofst, ierr, ndpts, idrsnum, mapdrslen
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ierr=g2_unpack5(cgrib,&iofst,&ndpts,&idrsnum,&idrstmpl,&mapdrslen)
+    iofst = <g2int>(ipos*8)
+    with nogil:
+        ierr=g2_unpack5(<unsigned char *>&cgrib[0],&iofst,&ndpts,&idrsnum,&idrstmpl,&mapdrslen)
     if ierr != 0:
        msg = "Error unpacking section 5 - error code = %i" % ierr
        raise RuntimeError(msg)
@@ -352,13 +343,13 @@ def unpack6(gribmsg,ndpts,ipos,object zeros):
                  6 = Memory allocation error
     """
     cdef object bitmap
-    cdef unsigned char *cgrib
+    cdef const unsigned char[::1] cgrib = gribmsg
     cdef g2int iofst, ierr, ngpts, ibmap
     cdef g2int *bmap
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ngpts = <g2int>PyInt_AsLong(ndpts)
-    ierr=g2_unpack6(cgrib,&iofst,ngpts,&ibmap,&bmap)
+    iofst = <g2int>(ipos*8)
+    ngpts = <g2int>ndpts
+    with nogil:
+        ierr=g2_unpack6(<unsigned char *>&cgrib[0],&iofst,ngpts,&ibmap,&bmap)
     if ierr != 0:
         msg = "Error unpacking section 6 - error code = %i" % ierr
         raise RuntimeError(msg)
@@ -370,7 +361,7 @@ def unpack6(gribmsg,ndpts,ipos,object zeros):
     return bitmap,ibmap
 
 
-def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object zeros,printminmax=False,storageorder="C"):
+def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object zeros,printminmax=False,storageorder="C",out=None):
     """
     Unpacks Section 7 (Data Section) as defined in GRIB Edition 2.
 
@@ -402,6 +393,9 @@ def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object
               in your python code.
     storageorder - "C" for row-major, or "F" for column-major (Default "C")
     printminmax - if True, min/max of fld is printed.
+    out      - Optional preallocated C-contiguous float32 numpy array of
+               size ndpts that the unpacked data field is copied into and
+               returned, avoiding a new array allocation per call.
 
     RETURNS:
     fld      - Numpy array (float32) containing the unpacked data field.
@@ -411,26 +405,20 @@ def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object
                  5 = Need one of GDT 3.50 through 3.53 to decode DRT 5.51
                  6 = Memory allocation error
     """
-    cdef unsigned char *cgrib
+    cdef const unsigned char[::1] cgrib = gribmsg
+    cdef g2int[::1] igdstmpl_mv = gdtmpl
+    cdef g2int[::1] idrstmpl_mv = drtmpl
     cdef g2int iofst, ierr, ngpts, idrsnum, igdsnum
-    cdef g2int *igdstmpl
-    cdef g2int *idrstmpl
     cdef g2float *fld
-    cdef void *drtmpldat
-    cdef void *gdtmpldat
+    cdef g2float[::1] out_mv
     cdef float rmin, rmax
     cdef int n
-    cdef Py_ssize_t buflen
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    iofst = <g2int>PyInt_AsLong(ipos*8)
-    ngpts = <g2int>PyInt_AsLong(ndpts)
-    idrsnum = <g2int>PyInt_AsLong(drtnum)
-    igdsnum = <g2int>PyInt_AsLong(gdtnum)
-    PyObject_AsReadBuffer(drtmpl, &drtmpldat, &buflen)
-    PyObject_AsReadBuffer(gdtmpl, &gdtmpldat, &buflen)
-    idrstmpl = <g2int *>drtmpldat
-    igdstmpl = <g2int *>gdtmpldat
-    ierr=g2_unpack7(cgrib,&iofst,igdsnum,igdstmpl,idrsnum,idrstmpl,ngpts,&fld)
+    iofst = <g2int>(ipos*8)
+    ngpts = <g2int>ndpts
+    idrsnum = <g2int>drtnum
+    igdsnum = <g2int>gdtnum
+    with nogil:
+        ierr=g2_unpack7(<unsigned char *>&cgrib[0],&iofst,igdsnum,&igdstmpl_mv[0],idrsnum,&idrstmpl_mv[0],ngpts,&fld)
     if ierr != 0:
        msg = "Error unpacking section 7 - error code = %i" % ierr
        raise RuntimeError(msg)
@@ -442,8 +430,8 @@ def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object
         for n from 0 <= n < ndpts:
             if fld[n] > rmax: rmax=fld[n]
             if fld[n] < rmin: rmin=fld[n]
-        fldmax = PyFloat_FromDouble(rmax)
-        fldmin = PyFloat_FromDouble(rmin)
+        fldmax = float(rmax)
+        fldmin = float(rmin)
         bitsofprecision = drtmpl[3]
         digitsofprecision = int(math.ceil(math.log10(math.pow(2,bitsofprecision))))
         format = "%."+repr(digitsofprecision+1)+"g"
@@ -451,13 +439,51 @@ def unpack7(gribmsg,gdtnum,object gdtmpl,drtnum,object drtmpl,ndpts,ipos,object
         minmaxstring = minmaxstring % (fldmin,fldmax)
         print(minmaxstring)
 
+    if out is not None:
+        # reshape() of a non-contiguous array returns a copy, which would
+        # receive the memcpy while the caller's buffer stays unmodified.
+        if not out.flags["C_CONTIGUOUS"]:
+            free(fld)
+            raise ValueError("out array must be C-contiguous.")
+        if out.size != ngpts:
+            free(fld)
+            raise ValueError("out array size must equal ndpts.")
+        try:
+            out_mv = out.reshape(ngpts)
+        except(ValueError):
+            free(fld)
+            raise
+        with nogil:
+            memcpy(&out_mv[0], fld, ngpts*sizeof(g2float))
+            free(fld)
+        return out
+
     data = _toarray(fld, zeros(ngpts, "f4", order=storageorder))
     return data
 
 # ----------------------------------------------------------------------------------------
 # Routines for writing grib2 files.
 # ----------------------------------------------------------------------------------------
-def grib2_create(object listsec0, object listsec1):
+cdef object _ensure_msgbuf(object gribmsg, Py_ssize_t pad):
+    """
+    Ensure the GRIB2 message buffer is a bytearray with at least pad bytes
+    of room past the current message length.
+
+    The message buffer is grown in place (amortized by bytearray) instead
+    of concatenating a new bytes object per section, which copied the
+    entire message so far on every section-add call.  The current message
+    length is read from Section 0, which the g2c routines keep updated.
+    """
+    if not isinstance(gribmsg, bytearray):
+        gribmsg = bytearray(gribmsg)
+    cursize = int.from_bytes(gribmsg[8:16],'big')
+    needed = cursize + pad
+    if len(gribmsg) < needed:
+        gribmsg.extend(bytes(needed-len(gribmsg)))
+    return gribmsg
+
+
+def grib2_create(object listsec0, object listsec1, size=0):
     """
     Initializes a new GRIB2 message and packs GRIB2 sections 0
     (Indicator Section) and 1 (Identification Section). This routine
@@ -489,33 +515,32 @@ def grib2_create(object listsec0, object listsec1):
                listsec1[10] = Reference Time - Second
                listsec1[11] = Production status of data (Code Table 1.3)
                listsec1[12] = Type of processed data (Code Table 1.4)
+    size     - Optional initial allocation in bytes for the message buffer
+               (e.g. an estimate of the total message size from Section 0).
+               Pre-sizing the buffer avoids reallocation as sections are
+               added.
 
    OUTPUT ARGUMENTS:
-   gribmsg  - string containing the new GRIB2 message.
+   gribmsg  - bytearray containing the new GRIB2 message.  The buffer may
+              be larger than the message; the message length is tracked in
+              Section 0 and the buffer is trimmed by grib2_end.
    ierr     - return code.
               > 0 = Current size of new GRIB2 message
                -1 = Tried to use for version other than GRIB Edition 2
     """
-    cdef g2int *isec0
-    cdef g2int *isec1
+    cdef g2int[::1] isec0 = listsec0
+    cdef g2int[::1] isec1 = listsec1
     cdef g2int ierr
-    cdef void *listsec0dat
-    cdef void *listsec1dat
-    cdef Py_ssize_t buflen
-    cdef unsigned char *cgrib
+    cdef unsigned char[::1] cgrib
     # cgrib needs to be big enough to hold sec0 and sec1.
     lgrib = 4*(len(listsec0)+len(listsec1))
-    gribmsg = lgrib*b" "
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    PyObject_AsReadBuffer(listsec0, &listsec0dat, &buflen)
-    PyObject_AsReadBuffer(listsec1, &listsec1dat, &buflen)
-    isec0 = <g2int *>listsec0dat
-    isec1 = <g2int *>listsec1dat
-    ierr = g2_create(cgrib,isec0,isec1)
+    gribmsg = bytearray(max(lgrib,size))
+    cgrib = gribmsg
+    with nogil:
+        ierr = g2_create(&cgrib[0],&isec0[0],&isec1[0])
     if ierr < 0:
        msg = "Error in grib2_create, error code = %i" % ierr
        raise RuntimeError(msg)
-    gribmsg = PyBytes_FromStringAndSize(<char *>cgrib, ierr)
     return gribmsg, ierr
 
 
@@ -548,15 +573,19 @@ def grib2_end(gribmsg):
               -4 = Previous Section was not 7.
     """
     cdef g2int ierr
-    cdef unsigned char *cgrib
+    cdef unsigned char[::1] cgrib
     # add some extra space to grib message (enough to hold section 8).
-    gribmsg = gribmsg + b"        "
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    ierr = g2_gribend(cgrib)
+    gribmsg = _ensure_msgbuf(gribmsg, 8)
+    cgrib = gribmsg
+    with nogil:
+        ierr = g2_gribend(&cgrib[0])
     if ierr < 0:
        msg = "error in grib2_end, error code = %i" % ierr
        raise RuntimeError(msg)
-    gribmsg = PyBytes_FromStringAndSize(<char *>cgrib, ierr)
+    # Trim the buffer in place to the final message length.  The buffer
+    # export must be released before the bytearray can be resized.
+    cgrib = None
+    del gribmsg[ierr:]
     return gribmsg, ierr
 
 def grib2_addgrid(gribmsg,object gds,object gdstmpl,object deflist=None, defnum = 0):
@@ -607,32 +636,25 @@ def grib2_addgrid(gribmsg,object gds,object gdstmpl,object deflist=None, defnum
               -5 = Could not find requested Grid Definition Template.
     """
     cdef g2int ierr, idefnum
-    cdef g2int *igds
-    cdef g2int *igdstmpl
-    cdef g2int *ideflist
-    cdef unsigned char  *cgrib
-    cdef void *gdsdat
-    cdef void *deflistdat
-    cdef void *gdstmpldat
-    cdef Py_ssize_t buflen
-    PyObject_AsReadBuffer(gds, &gdsdat, &buflen)
-    PyObject_AsReadBuffer(gdstmpl, &gdstmpldat, &buflen)
-    igds = <g2int *>gdsdat
-    igdstmpl = <g2int *>gdstmpldat
+    cdef g2int[::1] igds = gds
+    cdef g2int[::1] igdstmpl = gdstmpl
+    cdef g2int[::1] ideflist
+    cdef g2int *ideflistptr
+    cdef unsigned char[::1] cgrib
     if igds[2] != 0:
-       PyObject_AsReadBuffer(deflist, &deflistdat, &buflen)
-       ideflist = <g2int *>deflistdat
-       idefnum = <g2int>PyInt_AsLong(len(deflist))
+       ideflist = deflist
+       ideflistptr = &ideflist[0]
+       idefnum = <g2int>len(deflist)
     else:
-       ideflist = NULL
+       ideflistptr = NULL
        idefnum = 0
-    gribmsg = gribmsg + 4*(256+4+gds[2]+1)*b" "
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    ierr = g2_addgrid(cgrib, igds, igdstmpl, ideflist, idefnum)
+    gribmsg = _ensure_msgbuf(gribmsg, 4*(256+4+gds[2]+1)+4*idefnum)
+    cgrib = gribmsg
+    with nogil:
+        ierr = g2_addgrid(&cgrib[0], &igds[0], &igdstmpl[0], ideflistptr, idefnum)
     if ierr < 0:
        msg = "error in grib2_addgrid, error code = %i" % ierr
        raise RuntimeError(msg)
-    gribmsg = PyBytes_FromStringAndSize(<char *>cgrib, ierr)
     return gribmsg, ierr
 
 
@@ -709,48 +731,38 @@ def grib2_addfield(gribmsg,pdsnum,object pdstmpl,object coordlist,
              -10 = Error packing data field.
     """
     cdef g2int ierr,ipdsnum,numcoord,idrsnum
-    cdef g2int *ipdstmpl
-    cdef g2int *idrstmpl
-    cdef g2float *fld
-    cdef g2float *fcoordlist
-    cdef g2int *bmap
+    cdef g2int[::1] ipdstmpl = pdstmpl
+    cdef g2int[::1] idrstmpl = drstmpl
+    cdef g2float[::1] fld = field
+    cdef g2float[::1] fcoordlist
+    cdef g2float *fcoordlistptr
+    cdef g2int[::1] bmap
+    cdef g2int *bmapptr
     cdef g2int ngrdpts, ibmap
-    cdef void *pdtmpldat
-    cdef void *drtmpldat
-    cdef void *coordlistdat
-    cdef void *fielddat
-    cdef void *bitmapdat
-    cdef Py_ssize_t buflen
-    cdef unsigned char *cgrib
-    ipdsnum = <g2int>PyInt_AsLong(pdsnum)
-    PyObject_AsReadBuffer(pdstmpl, &pdtmpldat, &buflen)
-    ipdstmpl = <g2int *>pdtmpldat
-    idrsnum = <g2int>PyInt_AsLong(drsnum)
-    PyObject_AsReadBuffer(drstmpl, &drtmpldat, &buflen)
-    idrstmpl = <g2int *>drtmpldat
+    cdef unsigned char[::1] cgrib
+    ipdsnum = <g2int>pdsnum
+    idrsnum = <g2int>drsnum
     if coordlist is not None:
-        PyObject_AsReadBuffer(coordlist, &coordlistdat, &buflen)
-        fcoordlist = <g2float *>coordlistdat
+        fcoordlist = coordlist
+        fcoordlistptr = &fcoordlist[0]
         numcoord = len(coordlist)
     else:
-        fcoordlist = NULL
+        fcoordlistptr = NULL
         numcoord = 0
-    PyObject_AsReadBuffer(field, &fielddat, &buflen)
-    fld = <g2float *>fielddat
-    ibmap = <g2int>PyInt_AsLong(ibitmap)
+    ibmap = <g2int>ibitmap
     ngrdpts = len(field)
     if ibitmap == 0 or ibitmap == 254:
-        PyObject_AsReadBuffer(bitmap, &bitmapdat, &buflen)
-        bmap  = <g2int *>bitmapdat
+        bmap = bitmap
+        bmapptr = &bmap[0]
     else:
-        bmap = NULL
-    gribmsg = gribmsg + 4*(len(drstmpl)+ngrdpts+4)*b" "
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
-    ierr = g2_addfield(cgrib,ipdsnum,ipdstmpl,fcoordlist,numcoord,idrsnum,idrstmpl,fld,ngrdpts,ibmap,bmap)
+        bmapptr = NULL
+    gribmsg = _ensure_msgbuf(gribmsg, 4*(len(drstmpl)+ngrdpts+4))
+    cgrib = gribmsg
+    with nogil:
+        ierr = g2_addfield(&cgrib[0],ipdsnum,&ipdstmpl[0],fcoordlistptr,numcoord,idrsnum,&idrstmpl[0],&fld[0],ngrdpts,ibmap,bmapptr)
     if ierr < 0:
        msg = "error in grib2_addfield, error code = %i" % ierr
        raise RuntimeError(msg)
-    gribmsg = PyBytes_FromStringAndSize(<char *>cgrib, ierr)
     return gribmsg, ierr
 
 
@@ -788,17 +800,17 @@ def grib2_addlocal(gribmsg,object sec2):
     REMARKS: Note that the Local Use Section ( Section 2 ) can only follow
              Section 1 or Section 7 in a GRIB2 message.
     """
-    cdef unsigned char *cgrib
+    cdef unsigned char[::1] cgrib
     cdef unsigned char *csec2
     cdef g2int lcsec2
     cdef g2int ierr
     lcsec2 = len(sec2)
-    gribmsg = gribmsg + 4*(5+lcsec2)*b" "
-    cgrib = <unsigned char *>PyBytes_AsString(gribmsg)
+    gribmsg = _ensure_msgbuf(gribmsg, 4*(5+lcsec2))
+    cgrib = gribmsg
     csec2 = <unsigned char *>PyBytes_AsString(sec2)
-    ierr = g2_addlocal(cgrib,csec2,lcsec2)
+    with nogil:
+        ierr = g2_addlocal(&cgrib[0],csec2,lcsec2)
     if ierr < 0:
        msg = "error in grib2_addlocal, error code = %i" % ierr
        raise RuntimeError(msg)
-    gribmsg = PyBytes_FromStringAndSize(<char *>cgrib, ierr)
     return gribmsg, ierr
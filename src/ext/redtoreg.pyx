@@ -1,55 +1,95 @@
+# cython: boundscheck=False, wraparound=False, cdivision=True
+from cython.parallel import prange
 import numpy as np
 cimport numpy as npc
+
+# The per-latitude interpolation indices and weights depend only on the
+# number of longitudes per latitude, which is fixed for a given model grid,
+# so they are computed once and cached across messages.
+_weights_cache = {}
+
+def _compute_weights(nlons, lonsperlat):
+    """
+    compute linear interpolation indices and weights for converting a
+    reduced gaussian grid with lonsperlat points per latitude to a full
+    grid with nlons points per latitude.  returns (nlats,nlons) arrays of
+    the two neighbor indices into the flattened reduced grid and the
+    interpolation weight of the second neighbor.  latitudes with no data
+    points are marked with index -1.
+    """
+    nlats = len(lonsperlat)
+    imidx = np.full((nlats,nlons),-1,np.int64)
+    ipidx = np.full((nlats,nlons),-1,np.int64)
+    wgt = np.zeros((nlats,nlons),np.float32)
+    indx = 0
+    for j in range(nlats):
+        ilons = int(lonsperlat[j])
+        if ilons != 0:
+            # zxi is the grid index (relative to the reduced grid)
+            # of the i'th point on the full grid.
+            zxi = np.arange(nlons,dtype=np.float64)*ilons/nlons
+            im = zxi.astype(np.int64)
+            zdx = zxi-im
+            im = (im+ilons)%ilons
+            ip = (im+1+ilons)%ilons
+            imidx[j] = indx+im
+            ipidx[j] = indx+ip
+            wgt[j] = zdx.astype(np.float32)
+        indx = indx + ilons
+    return imidx, ipidx, wgt
+
 def _redtoreg(object nlonsin, npc.ndarray lonsperlat, npc.ndarray redgrid, \
               object missval):
     """
     convert data on global reduced gaussian to global
     full gaussian grid using linear interpolation.
+
+    operates natively on float32 data and parallelizes the latitude loop
+    with OpenMP when compiled with OpenMP support.  if one of the nearest
+    values is missing (equal to missval or NaN, e.g. masked out by a
+    bitmap), nearest neighbor interpolation is used instead.
     """
-    cdef long i, j, n, im, ip, indx, ilons, nlats, npts
-    cdef double zxi, zdx, flons, missvl
-    cdef npc.ndarray reggrid
-    cdef double *redgrdptr
-    cdef double *reggrdptr
-    cdef long *lonsptr
+    cdef long i, j, nlons, nlats
+    cdef npc.int64_t a, b
+    cdef float va, vb, w, missvl
     nlons = nlonsin
     nlats = len(lonsperlat)
-    npts = len(redgrid)
-    if lonsperlat.sum() != npts:
+    lonsperlat = np.ascontiguousarray(lonsperlat,dtype=np.int64)
+    redgrid = np.ascontiguousarray(redgrid,dtype=np.float32)
+    if lonsperlat.sum() != len(redgrid):
         msg='size of reduced grid does not match number of data values'
         raise ValueError(msg)
-    reggrid = missval*np.ones((nlats,nlons),np.double)
-    # get data buffers and cast to desired type.
-    lonsptr = <long *>lonsperlat.data
-    redgrdptr = <double *>redgrid.data
-    reggrdptr = <double *>reggrid.data
-    missvl = <double>missval
+    key = (nlons,lonsperlat.tobytes())
+    try:
+        imidx, ipidx, wgt = _weights_cache[key]
+    except KeyError:
+        imidx, ipidx, wgt = _compute_weights(nlons,lonsperlat)
+        _weights_cache[key] = (imidx,ipidx,wgt)
+    reggrid = np.empty((nlats,nlons),np.float32)
+    cdef const npc.int64_t[:,::1] imv = imidx
+    cdef const npc.int64_t[:,::1] ipv = ipidx
+    cdef const npc.float32_t[:,::1] wv = wgt
+    cdef const npc.float32_t[::1] red = redgrid
+    cdef npc.float32_t[:,::1] reg = reggrid
+    missvl = <float>missval
     # iterate over full grid, do linear interpolation.
-    n = 0
-    indx = 0
-    for j from 0 <= j < nlats:
-        ilons = lonsptr[j]
-        flons = <double>ilons
-        for i from 0 <= i < nlons:
-            # zxi is the grid index (relative to the reduced grid)
-            # of the i'th point on the full grid. 
-            zxi = i * flons / nlons # goes from 0 to ilons
-            im = <long>zxi
-            zdx = zxi - <double>im
-            if ilons != 0:
-                im = (im + ilons)%ilons
-                ip = (im + 1 + ilons)%ilons
-                # if one of the nearest values is missing, use nearest
-                # neighbor interpolation.
-                if redgrdptr[indx+im] == missvl or\
-                   redgrdptr[indx+ip] == missvl: 
-                    if zdx < 0.5:
-                        reggrdptr[n] = redgrdptr[indx+im]
-                    else:
-                        reggrdptr[n] = redgrdptr[indx+ip]
-                else: # linear interpolation.
-                    reggrdptr[n] = redgrdptr[indx+im]*(1.-zdx) +\
-                                   redgrdptr[indx+ip]*zdx
-            n = n + 1
-        indx = indx + ilons
+    for j in prange(nlats, nogil=True, schedule='static'):
+        for i in range(nlons):
+            a = imv[j,i]
+            if a < 0:
+                reg[j,i] = missvl
+                continue
+            b = ipv[j,i]
+            w = wv[j,i]
+            va = red[a]
+            vb = red[b]
+            # if one of the nearest values is missing, use nearest
+            # neighbor interpolation.
+            if va == missvl or va != va or vb == missvl or vb != vb:
+                if w < 0.5:
+                    reg[j,i] = va
+                else:
+                    reg[j,i] = vb
+            else: # linear interpolation.
+                reg[j,i] = va*(<float>1.0-w) + vb*w
     return reggrid
@@ -2,9 +2,11 @@ from ._grib2io import *
 from ._grib2io import __doc__
 from ._grib2io import _Grib2Message
 
-__all__ = ['open', 'show_config', 'interpolate', 'interpolate_to_stations',
-           'tables', 'templates', 'utils',
-           'Grib2Message', '_Grib2Message', 'Grib2GridDef']
+__all__ = ['open', 'open_many', 'show_config', 'interpolate',
+           'interpolate_to_stations', 'interpolate_to_stations_batch',
+           'interpolation_plan', 'get_stats', 'set_data_cache', 'stream',
+           'tables', 'templates', 'utils', 'Grib2Message', '_Grib2Message',
+           'Grib2Dataset', 'Grib2GridDef', 'InterpolationPlan']
 
 try:
     from . import __config__
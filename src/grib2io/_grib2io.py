@@ -23,25 +23,38 @@ The following Jupyter Notebooks are available as tutorials:
 
 from dataclasses import dataclass, field
 from typing import Literal, Optional, Union
+import base64
 import builtins
 import collections
+import concurrent.futures
 import copy
 import datetime
 import hashlib
+import io
+import json
+import mmap
 import os
 import re
 import struct
 import sys
+import threading
+import time
 import warnings
+import weakref
 
 from numpy.typing import NDArray
 import numpy as np
 import pyproj
 
 from . import g2clib
+try:
+    from . import cmplxunpack
+except(ImportError):
+    cmplxunpack = None
 from . import tables
 from . import templates
 from . import utils
+from ._remote import DEFAULT_BLOCK_SIZE, RemoteFile, is_remote_url
 
 DEFAULT_DRT_LEN = 20
 DEFAULT_FILL_VALUE = 9.9692099683868690e+36
@@ -49,11 +62,71 @@ DEFAULT_NUMPY_INT = np.int64
 GRIB2_EDITION_NUMBER = 2
 TYPE_OF_VALUES_DTYPE = ('float32','int32')
 
+INDEX_FILE_EXTENSION = '.g2idx'
+INDEX_FILE_MAGIC = b'G2IDX'
+INDEX_FILE_VERSION = 2
+
+def _index_json_default(obj):
+    """JSON encoder hook for the numpy scalars and arrays in the index."""
+    if isinstance(obj,np.ndarray):
+        return obj.tolist()
+    if isinstance(obj,np.integer):
+        return int(obj)
+    if isinstance(obj,np.floating):
+        return float(obj)
+    raise TypeError(f"Object of type {type(obj).__name__} is not JSON serializable.")
+
 _interp_schemes = {'bilinear':0, 'bicubic':1, 'neighbor':2,
                    'budget':3, 'spectral':4, 'neighbor-budget':6}
 
+_select_index_attrs = ('shortName', 'level', 'leadTime',
+                       'perturbationNumber', 'duration')
+
+# Serializes on-disk data reads for messages being packed on worker
+# threads; their source file handles are shared seek/read objects.
+_decode_lock = threading.Lock()
+
+# Library-level decoded-data cache (see set_data_cache).  Disabled (zero
+# byte budget) by default.
+_DATA_CACHE_BUDGET = 0
+_data_cache = collections.OrderedDict()
+_data_cache_bytes = 0
+_data_cache_lock = threading.Lock()
+
 _AUTO_NANS = True
 
+# Hot-path instrumentation (see open.stats and get_stats()).  Counters
+# are plain attribute increments on __slots__ objects, so the overhead
+# when nobody reads them is a few adds per operation.
+class _Stats:
+    """Hot-path counters for one file, or for the library as a whole."""
+    __slots__ = ('bytes_read','seeks','messages_indexed','fields_decoded',
+                 'fields_packed','cache_hits','cache_misses',
+                 'index_seconds','decode_seconds','pack_seconds')
+    def __init__(self):
+        self.bytes_read = 0
+        self.seeks = 0
+        self.messages_indexed = 0
+        self.fields_decoded = 0
+        self.fields_packed = 0
+        self.cache_hits = 0
+        self.cache_misses = 0
+        self.index_seconds = 0.0
+        self.decode_seconds = 0.0
+        self.pack_seconds = 0.0
+    def _as_dict(self):
+        return {k:getattr(self,k) for k in self.__slots__}
+
+_global_stats = _Stats()
+
+# Per-open counter sets weakly keyed by the file handle, so the
+# module-level read and decode paths (_read_at, _data) can attribute
+# their work to the owning open.  Weak keys mean a handle dropped
+# without close() takes its entry with it rather than leaking it or
+# misattributing counters to a later handle reusing its id().
+_stats_by_handle = weakref.WeakKeyDictionary()
+
+_griddef_datastore = dict()
 _latlon_datastore = dict()
 _msg_class_store = dict()
 
@@ -88,14 +161,17 @@ class open():
         Full path name of the GRIB2 file.
     size : int
         Size of the file in units of bytes.
+    stats : dict
+        Hot-path counters for this file (bytes read, seeks, messages
+        indexed, fields decoded, cache hits/misses, and time accumulators).
     variables : tuple
         Tuple containing a unique list of variable short names (i.e. GRIB2
         abbreviation names).
     """
 
-    __slots__ = ('_fileid', '_filehandle', '_hasindex', '_index', '_nodata',
-                 '_pos', 'closed', 'current_message', 'messages', 'mode',
-                 'name', 'size')
+    __slots__ = ('_fileid', '_filehandle', '_hasindex', '_index', '_lazy',
+                 '_mmapfh', '_nodata', '_pos', '_stats', 'closed',
+                 'current_message', 'messages', 'mode', 'name', 'size')
 
     def __init__(self, filename: str, mode: Literal["r", "w", "x"] = "r", **kwargs):
         """
@@ -104,17 +180,58 @@ class open():
         Parameters
         ----------
         filename
-            File name containing GRIB2 messages.
+            File name containing GRIB2 messages or an `https://`, `http://`,
+            or `s3://` URL of a remote GRIB2 file.  Remote files are read
+            with byte-range requests, fetching only the sections that are
+            accessed rather than downloading the whole file.
         mode: default="r"
             File access mode where "r" opens the files for reading only; "w"
             opens the file for overwriting and "x" for writing to a new file.
+            Remote files are read-only.
+        save_index: default=False
+            If `True`, save the index to a binary sidecar index file
+            (`filename` + ".g2idx") after the initial indexing scan.  On
+            subsequent opens, a sidecar index file is always checked for and
+            loaded when it validates against the GRIB2 file (size and
+            modification time), which avoids a full re-scan of the file.
+        workers: default=None
+            Number of worker processes to use for indexing.  When a value
+            greater than 1 is given, the file is first swept for GRIB2 message
+            offsets (a cheap pass using the total message length in Section 0)
+            and the section decoding is distributed across a process pool with
+            the index assembled in message order.  The default value of `None`
+            performs the indexing sequentially.
+        lazy: default=False
+            If `True`, defer the decoding of GRIB2 sections 1, 3, 4, and 5
+            during indexing.  Indexing records section offsets, sizes, and raw
+            section bytes only, and each message is decoded on first attribute
+            access.  This speeds up opening files where only a subset of the
+            messages will ever be touched.
+        mmap: default=False
+            If `True`, memory-map the file and serve all reads during
+            indexing and data unpacking from the mapping rather than through
+            file object read() calls.  Concurrent readers of the same file
+            then share pages from the OS page cache instead of duplicating
+            read buffers.  Not supported for gzipped GRIB2 files.
+        blocksize: default=262144
+            For remote files only, the size in bytes of the cached blocks
+            fetched by range request.  Adjacent uncached blocks are
+            coalesced into single range requests.
         """
+        # Accept path-like objects (e.g. pathlib.Path) for local files.
+        # Remote URLs are always given as str.
+        if not isinstance(filename, str):
+            filename = os.fspath(filename)
+
         # Manage keywords
         if "_xarray_backend" not in kwargs:
             kwargs["_xarray_backend"] = False
             self._nodata = False
         else:
             self._nodata = kwargs["_xarray_backend"]
+        save_index = kwargs.get("save_index", False)
+        workers = kwargs.get("workers", None)
+        self._lazy = kwargs.get("lazy", False)
 
         # All write modes are read/write.
         # All modes are binary.
@@ -122,35 +239,78 @@ class open():
             mode += "+"
         mode = mode + "b"
 
-        # Some GRIB2 files are gzipped, so check for that here, but
-        # raise error when using xarray backend.
-        if 'r' in mode:
-            self._filehandle = builtins.open(filename, mode=mode)
-            # Gzip files contain a 2-byte header b'\x1f\x8b'.
-            if self._filehandle.read(2) == b'\x1f\x8b':
-                self._filehandle.close()
-                if kwargs["_xarray_backend"]:
-                    raise RuntimeError('Gzip GRIB2 files are not supported by the Xarray backend.')
-                import gzip
-                self._filehandle = gzip.open(filename, mode=mode)
+        if is_remote_url(filename):
+            # Remote GRIB2 files are accessed with byte-range requests
+            # through a file-like object; only read mode is supported.
+            if 'r' not in mode:
+                raise ValueError("Remote GRIB2 files are read-only.")
+            self._filehandle = RemoteFile(filename,
+                                          blocksize=kwargs.get("blocksize",
+                                                               DEFAULT_BLOCK_SIZE))
+            self.name = filename
+            fsize = self._filehandle.size
+            fmtime = self._filehandle.mtime
+            finode = 0
+        else:
+            # Some GRIB2 files are gzipped, so check for that here, but
+            # raise error when using xarray backend.
+            if 'r' in mode:
+                self._filehandle = builtins.open(filename, mode=mode)
+                # Gzip files contain a 2-byte header b'\x1f\x8b'.
+                if self._filehandle.read(2) == b'\x1f\x8b':
+                    self._filehandle.close()
+                    if kwargs["_xarray_backend"]:
+                        raise RuntimeError('Gzip GRIB2 files are not supported by the Xarray backend.')
+                    import gzip
+                    self._filehandle = gzip.open(filename, mode=mode)
+                else:
+                    self._filehandle = builtins.open(filename, mode=mode)
             else:
                 self._filehandle = builtins.open(filename, mode=mode)
-        else:
-            self._filehandle = builtins.open(filename, mode=mode)
 
-        self.name = os.path.abspath(filename)
-        fstat = os.stat(self.name)
+            self.name = os.path.abspath(filename)
+            fstat = os.stat(self.name)
+            fsize = fstat.st_size
+            fmtime = fstat.st_mtime
+            finode = fstat.st_ino
+
         self._hasindex = False
         self._index = {}
         self.mode = mode
         self.messages = 0
         self.current_message = 0
-        self.size = fstat.st_size
+        self.size = fsize
         self.closed = self._filehandle.closed
-        self._fileid = hashlib.sha1((self.name+str(fstat.st_ino)+
+        self._fileid = hashlib.sha1((self.name+str(finode)+
                                      str(self.size)).encode('ASCII')).hexdigest()
+
+        # Memory-map the file if requested.  The real file object is kept
+        # open for the lifetime of the mapping and all reads go through the
+        # mapping, which quacks like a file (read/seek/tell).
+        self._mmapfh = None
+        if kwargs.get("mmap", False) and 'r' in self.mode and self.size > 0 \
+           and not isinstance(self._filehandle, RemoteFile):
+            if self._filehandle.__class__.__module__ == 'gzip':
+                raise RuntimeError('Memory-mapping is not supported for gzip GRIB2 files.')
+            self._mmapfh = self._filehandle
+            self._filehandle = mmap.mmap(self._mmapfh.fileno(), 0,
+                                         access=mmap.ACCESS_READ)
+
+        self._stats = _Stats()
+        _stats_by_handle[self._filehandle] = self._stats
+
         if 'r' in self.mode:
-            self._build_index()
+            if isinstance(self._filehandle, RemoteFile):
+                # Sidecar index files and worker processes (which re-open
+                # the file by name) do not apply to remote files.
+                self._build_index()
+            elif not self._load_index(fmtime):
+                if workers is not None and workers > 1:
+                    self._build_index_parallel(workers)
+                else:
+                    self._build_index()
+                if save_index:
+                    self._save_index(fmtime)
         # FIX: Cannot perform reads on mode='a'
         #if 'a' in self.mode and self.size > 0: self._build_index()
 
@@ -200,6 +360,9 @@ class open():
 
     def _build_index(self):
         """Perform indexing of GRIB2 Messages."""
+        nmsgs0 = self.messages
+        t0 = time.monotonic()
+
         # Initialize index dictionary
         if not self._hasindex:
             self._index['sectionOffset'] = []
@@ -221,6 +384,7 @@ class open():
                 _secpos = dict.fromkeys(range(8))
                 _secsize = dict.fromkeys(range(8))
                 _isSubmessage = False
+                rawsec = dict.fromkeys((1,3,4,5))
 
                 # Ignore headers (usually text) that are not part of the GRIB2
                 # file.  For example, NAVGEM files have a http header at the
@@ -277,7 +441,10 @@ class open():
                     grbpos = 0
 
                     # Unpack section
-                    if secnum == 1:
+                    if secnum in {1,3,4,5} and self._lazy:
+                        # Defer section decoding; record raw section bytes.
+                        rawsec[secnum] = secmsg
+                    elif secnum == 1:
                         # Unpack Section 1
                         section1, grbpos = g2clib.unpack1(secmsg,grbpos,np.empty)
                     elif secnum == 2:
@@ -324,16 +491,28 @@ class open():
                         self._index['msgNumber'].append(self.messages)
                         self._index['isSubmessage'].append(_isSubmessage)
 
-                        # Create Grib2Message with data.
-                        msg = Grib2Message(section0,section1,section2,section3,section4,section5,bmapflag)
-                        msg._msgnum = self.messages-1
-                        msg._deflist = deflist
-                        msg._coordlist = coordlist
-                        if not self._nodata:
-                            msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
-                                                                TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
-                                                                self._filehandle,
-                                                                msg, pos, _secpos[6], _secpos[7])
+                        # Create Grib2Message with data.  In lazy mode, a
+                        # deferred-decode proxy holding the raw section bytes
+                        # is indexed instead.
+                        if self._lazy:
+                            msg = Grib2MessageDeferred(section0,rawsec.copy(),
+                                                       section2,bmapflag,
+                                                       self._filehandle,
+                                                       self._nodata,
+                                                       self.messages-1,
+                                                       pos, _secpos[6], _secpos[7])
+                            msg._isSubmessage = _isSubmessage
+                        else:
+                            msg = Grib2Message(section0,section1,section2,section3,section4,section5,bmapflag)
+                            msg._msgnum = self.messages-1
+                            msg._deflist = deflist
+                            msg._coordlist = coordlist
+                            msg._isSubmessage = _isSubmessage
+                            if not self._nodata:
+                                msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
+                                                                    TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
+                                                                    self._filehandle,
+                                                                    msg, pos, _secpos[6], _secpos[7])
                         self._index['msg'].append(msg)
 
                         # If here, then we have moved through GRIB2 section 1-7.
@@ -364,6 +543,251 @@ class open():
                     self._filehandle.seek(0)
                 break
 
+        elapsed = time.monotonic()-t0
+        newmsgs = self.messages-nmsgs0
+        self._stats.messages_indexed += newmsgs
+        self._stats.index_seconds += elapsed
+        _global_stats.messages_indexed += newmsgs
+        _global_stats.index_seconds += elapsed
+
+        # Any newly indexed messages invalidate the select() indexes.
+        self._index.pop('attrs',None)
+
+
+    def _scan_message_offsets(self):
+        """
+        Sweep the file for the byte offset of each GRIB2 message.
+
+        This is the cheap portion of indexing.  Only Section 0 of each
+        message is read and the total message length is used to jump to the
+        next message, so no section decoding is performed.
+
+        Returns
+        -------
+        _scan_message_offsets
+            List of byte offsets, one per GRIB2 message.
+        """
+        offsets = []
+        self._filehandle.seek(0)
+        while True:
+            try:
+                pos = self._filehandle.tell()
+                for test_offset in range(2048):
+                    self._filehandle.seek(pos + test_offset)
+                    header = struct.unpack(">I", self._filehandle.read(4))[0]
+                    if header.to_bytes(4, "big") == b"GRIB":
+                        pos = pos + test_offset
+                        break
+                else:
+                    continue
+                secmsg = self._filehandle.read(12)
+                section0 = struct.unpack('>HBBQ',secmsg)
+                if section0[2] != 2:
+                    # Check for GRIB1 and ignore.
+                    if secmsg[3] == 1:
+                        grib1_size = int.from_bytes(secmsg[:3],"big")
+                        self._filehandle.seek(pos+grib1_size)
+                        continue
+                    else:
+                        raise ValueError("Bad GRIB version number.")
+                offsets.append(pos)
+                self._filehandle.seek(pos+section0[3])
+            except(struct.error):
+                self._filehandle.seek(0)
+                break
+        return offsets
+
+
+    def _build_index_parallel(self, workers: int):
+        """
+        Perform indexing of GRIB2 Messages across a process pool.
+
+        The file is first swept for message offsets, then section decoding
+        is farmed out across worker processes with the index assembled in
+        message order.
+
+        Parameters
+        ----------
+        workers
+            Number of worker processes.
+        """
+        if self._filehandle.__class__.__module__ == 'gzip':
+            # Workers perform positioned reads against the file on disk which
+            # is not possible for gzipped files.
+            self._build_index()
+            return
+
+        nmsgs0 = self.messages
+        t0 = time.monotonic()
+
+        # Initialize index dictionary
+        if not self._hasindex:
+            self._index['sectionOffset'] = []
+            self._index['sectionSize'] = []
+            self._index['msgSize'] = []
+            self._index['msgNumber'] = []
+            self._index['msg'] = []
+            self._index['isSubmessage'] = []
+            self._hasindex = True
+
+        offsets = self._scan_message_offsets()
+        with concurrent.futures.ProcessPoolExecutor(max_workers=workers) as pool:
+            results = pool.map(_unpack_message_at,
+                               [self.name]*len(offsets), offsets,
+                               chunksize=max(1,len(offsets)//(workers*4)))
+
+        for records in results:
+            for record in records:
+                self.messages += 1
+                self._index['sectionOffset'].append(record['sectionOffset'])
+                self._index['sectionSize'].append(record['sectionSize'])
+                self._index['msgSize'].append(record['msgSize'])
+                self._index['msgNumber'].append(self.messages)
+                self._index['isSubmessage'].append(record['isSubmessage'])
+
+                section0, section1, section2, section3, section4, section5, \
+                    bmapflag, deflist, coordlist = record['sections']
+                msg = Grib2Message(section0,section1,section2,section3,
+                                   section4,section5,bmapflag)
+                msg._msgnum = self.messages-1
+                msg._deflist = deflist
+                msg._coordlist = coordlist
+                if not self._nodata:
+                    msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
+                                                        TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
+                                                        self._filehandle,
+                                                        msg,
+                                                        record['sectionOffset'][0],
+                                                        record['sectionOffset'][6],
+                                                        record['sectionOffset'][7])
+                self._index['msg'].append(msg)
+
+        elapsed = time.monotonic()-t0
+        newmsgs = self.messages-nmsgs0
+        self._stats.messages_indexed += newmsgs
+        self._stats.index_seconds += elapsed
+        _global_stats.messages_indexed += newmsgs
+        _global_stats.index_seconds += elapsed
+
+
+    def _save_index(self, mtime: float):
+        """
+        Save the file index to a binary sidecar index file.
+
+        The sidecar index file is the GRIB2 file name appended with ".g2idx".
+        It contains a small header (magic string and format version) followed
+        by a JSON document holding the indexed GRIB2 section metadata.  JSON
+        is used deliberately: a sidecar is plain data and loading one must
+        not be able to execute code.  The GRIB2 file size and modification
+        time are stored so the index can be validated against the GRIB2 file
+        on subsequent opens.
+
+        Parameters
+        ----------
+        mtime
+            Modification time of the GRIB2 file at indexing time.
+        """
+        msgs = []
+        for msg in self._index['msg']:
+            msgs.append((msg.section0, msg.section1,
+                         base64.b64encode(bytes(msg.section2)).decode('ascii'),
+                         msg.section3, msg.section4, msg.section5,
+                         msg.bitMapFlag.value, msg._deflist, msg._coordlist))
+        payload = dict(size=self.size,
+                       mtime=mtime,
+                       sectionOffset=self._index['sectionOffset'],
+                       sectionSize=self._index['sectionSize'],
+                       msgSize=self._index['msgSize'],
+                       msgNumber=self._index['msgNumber'],
+                       isSubmessage=self._index['isSubmessage'],
+                       msgs=msgs)
+        try:
+            with builtins.open(self.name+INDEX_FILE_EXTENSION,'wb') as idxfile:
+                idxfile.write(INDEX_FILE_MAGIC)
+                idxfile.write(struct.pack('>H',INDEX_FILE_VERSION))
+                idxfile.write(json.dumps(payload,
+                                         default=_index_json_default).encode('utf-8'))
+        except(OSError,TypeError):
+            warnings.warn(f"Could not write sidecar index file for {self.name}")
+
+
+    def _load_index(self, mtime: float):
+        """
+        Load the file index from a binary sidecar index file.
+
+        The sidecar index is only used when its magic string and format
+        version are recognized and the stored GRIB2 file size and modification
+        time match the current file, otherwise `False` is returned and a full
+        indexing scan is performed by the caller.  The payload is a JSON
+        document (see `_save_index`), so loading a planted or corrupt
+        sidecar can fail but cannot execute code.
+
+        Parameters
+        ----------
+        mtime
+            Current modification time of the GRIB2 file.
+
+        Returns
+        -------
+        _load_index
+            `True` if the index was loaded from the sidecar index file,
+            `False` otherwise.
+        """
+        idxname = self.name+INDEX_FILE_EXTENSION
+        if not os.path.exists(idxname):
+            return False
+        try:
+            with builtins.open(idxname,'rb') as idxfile:
+                if idxfile.read(len(INDEX_FILE_MAGIC)) != INDEX_FILE_MAGIC:
+                    return False
+                version = struct.unpack('>H',idxfile.read(2))[0]
+                if version != INDEX_FILE_VERSION:
+                    return False
+                payload = json.loads(idxfile.read().decode('utf-8'))
+        except(OSError,UnicodeDecodeError,json.JSONDecodeError,
+               struct.error,EOFError):
+            return False
+        if payload['size'] != self.size or payload['mtime'] != mtime:
+            return False
+
+        # JSON stringifies the section-number keys of the per-message
+        # offset/size dictionaries; restore them to ints.
+        self._index['sectionOffset'] = [{int(k):v for k,v in d.items()}
+                                        for d in payload['sectionOffset']]
+        self._index['sectionSize'] = [{int(k):v for k,v in d.items()}
+                                      for d in payload['sectionSize']]
+        self._index['msgSize'] = payload['msgSize']
+        self._index['msgNumber'] = payload['msgNumber']
+        self._index['isSubmessage'] = payload['isSubmessage']
+        self._index['msg'] = []
+        for n,sections in enumerate(payload['msgs']):
+            section0, section1, section2, section3, section4, section5, \
+                bmapflag, deflist, coordlist = sections
+            msg = Grib2Message(np.array(section0,dtype=np.int64),
+                               np.array(section1,dtype=np.int64),
+                               base64.b64decode(section2),
+                               np.array(section3,dtype=np.int64),
+                               np.array(section4,dtype=np.int64),
+                               np.array(section5,dtype=np.int64),
+                               bmapflag)
+            msg._msgnum = n
+            msg._deflist = None if deflist is None else \
+                           np.array(deflist,dtype=np.int64)
+            msg._coordlist = None if coordlist is None else \
+                             np.array(coordlist,dtype=np.float32)
+            if not self._nodata:
+                msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
+                                                    TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
+                                                    self._filehandle,
+                                                    msg,
+                                                    self._index['sectionOffset'][n][0],
+                                                    self._index['sectionOffset'][n][6],
+                                                    self._index['sectionOffset'][n][7])
+            self._index['msg'].append(msg)
+        self.messages = len(self._index['msg'])
+        self._hasindex = True
+        return True
+
 
     @property
     def levels(self):
@@ -381,15 +805,76 @@ class open():
             return None
 
 
+    @property
+    def stats(self):
+        """Hot-path counters for this file as a dictionary (bytes read,
+        seeks, messages indexed, fields decoded, cache hits/misses, and
+        monotonic-clock time accumulators)."""
+        return self._stats._as_dict()
+
+
     def close(self):
         """Close the file handle."""
         if not self._filehandle.closed:
             self.messages = 0
             self.current_message = 0
+            _stats_by_handle.pop(self._filehandle,None)
             self._filehandle.close()
+            if self._mmapfh is not None:
+                self._mmapfh.close()
             self.closed = self._filehandle.closed
 
 
+    def refresh(self):
+        """
+        Index any GRIB2 messages appended to the file since it was opened.
+
+        The file is re-stat'ed and the indexing loop resumes from the end
+        of the last indexed message, so only new messages are parsed and
+        appended to the index.  This lets a consumer poll a file that is
+        still being written (e.g. a streaming model run) at near-zero
+        cost; when the file has not grown, this is a no-op.
+
+        Returns
+        -------
+        refresh
+            The number of newly indexed GRIB2 messages.
+        """
+        if 'r' not in self.mode:
+            raise ValueError("refresh() requires a file opened for reading.")
+        if isinstance(self._filehandle, RemoteFile):
+            raise NotImplementedError("refresh() is not supported for remote GRIB2 files.")
+        if self._filehandle.__class__.__module__ == 'gzip':
+            raise NotImplementedError("refresh() is not supported for gzip GRIB2 files.")
+
+        fstat = os.stat(self.name)
+        if fstat.st_size <= self.size and self.messages > 0:
+            return 0
+        self.size = fstat.st_size
+        self._fileid = hashlib.sha1((self.name+str(fstat.st_ino)+
+                                     str(self.size)).encode('ASCII')).hexdigest()
+
+        # A memory-mapped file needs a new mapping to see the appended
+        # bytes.  The previous mapping is left open since already-indexed
+        # messages hold references to it.
+        if self._mmapfh is not None:
+            _stats_by_handle.pop(self._filehandle,None)
+            self._filehandle = mmap.mmap(self._mmapfh.fileno(), 0,
+                                         access=mmap.ACCESS_READ)
+            _stats_by_handle[self._filehandle] = self._stats
+
+        # Resume the indexing loop at the end of the last indexed message.
+        if self.messages > 0:
+            resume = int(self._index['sectionOffset'][-1][0] +
+                         self._index['msgSize'][-1])
+        else:
+            resume = 0
+        before = self.messages
+        self._filehandle.seek(resume)
+        self._build_index()
+        return self.messages - before
+
+
     def read(self, size: Optional[int]=None):
         """
         Read size amount of GRIB2 messages from the current position.
@@ -429,6 +914,79 @@ class open():
             None
 
 
+    def data(self, messages: Optional[list]=None, workers: int=1):
+        """
+        Unpack the data for a set of GRIB2 messages into a single array.
+
+        All messages must be on the same grid.  Data reads use positioned
+        reads (os.pread), so worker threads are not serialized behind the
+        shared file pointer, and they contend for the interpreter lock
+        only in the numpy post-processing since the g2c unpacking releases
+        the GIL.
+
+        Parameters
+        ----------
+        messages: default=None
+            Sequence of ``Grib2Message`` objects to decode (e.g. the list
+            returned from `open.select`).  If `None`, all messages in the
+            file are decoded.
+        workers: default=1
+            Number of worker threads used to decode messages concurrently.
+
+        Returns
+        -------
+        data
+            numpy.ndarray with shape (nmsgs,ny,nx) of unpacked data values.
+        """
+        if messages is None:
+            messages = self._index['msg']
+        messages = [m._materialize() if isinstance(m,Grib2MessageDeferred)
+                    else m for m in messages]
+        if len(messages) == 0:
+            return np.array([],dtype=np.float32)
+        ny, nx = messages[0].ny, messages[0].nx
+        for m in messages:
+            if m._ondiskarray is None:
+                raise ValueError("Grib2Message object has no data on disk.")
+            if (m.ny,m.nx) != (ny,nx):
+                raise ValueError("GRIB2 messages must be on the same grid.")
+
+        out = np.empty((len(messages),ny,nx),
+                       dtype=TYPE_OF_VALUES_DTYPE[messages[0].typeOfValues])
+
+        if isinstance(self._filehandle, RemoteFile):
+            # Fetch the bitmap and data section ranges of all requested
+            # messages up front with coalesced, concurrent range requests,
+            # then decode from the cached blocks.
+            ranges = []
+            for m in messages:
+                oda = m._ondiskarray
+                start = oda.data_offset if oda.bitmap_offset is None \
+                        else oda.bitmap_offset
+                stop = oda.data_offset+self._index['sectionSize'][m._msgnum][7]
+                ranges.append((start,stop))
+            self._filehandle.prefetch(ranges, workers=max(workers,4))
+            for n,m in enumerate(messages):
+                out[n] = np.asarray(m._ondiskarray)
+            return out
+
+        if workers <= 1 or self._filehandle.__class__.__module__ == 'gzip':
+            for n,m in enumerate(messages):
+                out[n] = np.asarray(m._ondiskarray)
+            return out
+
+        def _decode(n):
+            # _data() uses positioned reads, so the shared file handle can
+            # be used from every worker thread.
+            oda = messages[n]._ondiskarray
+            _data(self._filehandle,messages[n],oda.bitmap_offset,
+                  oda.data_offset,out=out[n])
+
+        with concurrent.futures.ThreadPoolExecutor(max_workers=workers) as pool:
+            list(pool.map(_decode,range(len(messages))))
+        return out
+
+
     def seek(self, pos: int):
         """
         Set the position within the file in units of GRIB2 messages.
@@ -448,16 +1006,61 @@ class open():
         return self.current_message
 
 
+    def _build_select_index(self):
+        """
+        Build inverted indexes for the common selection attributes.
+
+        Each index maps an attribute value to the set of message numbers
+        carrying that value, so `open.select` can intersect precomputed
+        sets instead of walking every message per keyword.  The indexes
+        are built once, on the first call to `open.select`, and held in
+        the file index.
+        """
+        attrs = {a:{} for a in _select_index_attrs}
+        for m in self._index['msg']:
+            for a in _select_index_attrs:
+                if hasattr(m,a):
+                    attrs[a].setdefault(getattr(m,a),set()).add(m._msgnum)
+        self._index['attrs'] = attrs
+
+
     def select(self, **kwargs):
-        """Select GRIB2 messages by `Grib2Message` attributes."""
-        # TODO: Added ability to process multiple values for each keyword (attribute)
-        idxs = []
-        nkeys = len(kwargs.keys())
+        """
+        Select GRIB2 messages by `Grib2Message` attributes.
+
+        Each keyword value can be a single value or a list, tuple, or set
+        of values, in which case messages matching any of the values for
+        that keyword are selected.  Selection on shortName, level,
+        leadTime, perturbationNumber, and duration is accelerated by
+        inverted indexes built on first use; other attributes fall back to
+        scanning the candidate messages.
+        """
+        if len(kwargs) == 0:
+            return []
+        if 'attrs' not in self._index:
+            self._build_select_index()
+        idxs = None
+        scan_attrs = {}
         for k,v in kwargs.items():
-            for m in self._index['msg']:
-                if hasattr(m,k) and getattr(m,k) == v: idxs.append(m._msgnum)
-        idxs = np.array(idxs,dtype=np.int32)
-        return [self._index['msg'][i] for i in [ii[0] for ii in collections.Counter(idxs).most_common() if ii[1] == nkeys]]
+            values = v if isinstance(v,(list,tuple,set)) else [v]
+            if k in self._index['attrs']:
+                matches = set()
+                for value in values:
+                    matches |= self._index['attrs'][k].get(value,set())
+                idxs = matches if idxs is None else idxs & matches
+            else:
+                scan_attrs[k] = values
+        if len(scan_attrs) > 0:
+            if idxs is None:
+                candidates = self._index['msg']
+            else:
+                candidates = [self._index['msg'][i] for i in sorted(idxs)]
+            idxs = set()
+            for m in candidates:
+                if all(hasattr(m,k) and getattr(m,k) in values
+                       for k,values in scan_attrs.items()):
+                    idxs.add(m._msgnum)
+        return [self._index['msg'][i] for i in sorted(idxs)]
 
 
     def write(self, msg):
@@ -474,6 +1077,9 @@ class open():
                 self.write(m)
             return
 
+        if isinstance(msg,Grib2MessageDeferred):
+            msg = msg._materialize()
+
         if issubclass(msg.__class__,_Grib2Message):
             if hasattr(msg,'_msg'):
                 self._filehandle.write(msg._msg)
@@ -482,9 +1088,14 @@ class open():
                     msg.pack()
                     self._filehandle.write(msg._msg)
                 else:
-                    if hasattr(msg._data,'filehandle'):
-                        msg._data.filehandle.seek(msg._data.offset)
-                        self._filehandle.write(msg._data.filehandle.read(msg.section0[-1]))
+                    if msg._ondiskarray is not None and \
+                    not getattr(msg,'_isSubmessage',False):
+                        # Metadata is unmodified, so the original message
+                        # bytes are copied verbatim without decoding and
+                        # re-encoding the data.
+                        self._copy_raw_message(msg._ondiskarray.filehandle,
+                                               msg._ondiskarray.offset,
+                                               int(msg.section0[-1]))
                     else:
                         msg.pack()
                         self._filehandle.write(msg._msg)
@@ -497,6 +1108,100 @@ class open():
         return
 
 
+    def _copy_raw_message(self, src, offset, size):
+        """
+        Copy a raw GRIB2 message byte span from a source file into this file.
+
+        When both ends are regular files, os.copy_file_range performs the
+        copy inside the kernel without moving the bytes through Python.
+        Otherwise (gzip, remote, or unsupported filesystems) the span is
+        read with a positioned read and written out.
+
+        Parameters
+        ----------
+        src
+            Open file object the message was read from.
+        offset
+            Byte offset of the message in the source file.
+        size
+            Total size of the message in bytes.
+        """
+        if hasattr(os,'copy_file_range') and hasattr(src,'fileno') and \
+        src.__class__.__module__ != 'gzip':
+            self.flush()
+            copied = 0
+            try:
+                srcfd = src.fileno()
+                dstfd = self._filehandle.fileno()
+                dstpos = self._filehandle.tell()
+                while copied < size:
+                    nbytes = os.copy_file_range(srcfd,dstfd,size-copied,
+                                                offset+copied,dstpos+copied)
+                    if nbytes == 0:
+                        break
+                    copied += nbytes
+            except(OSError,io.UnsupportedOperation):
+                copied = 0
+            if copied > 0:
+                self._filehandle.seek(dstpos+copied)
+            if copied == size:
+                return
+            offset += copied
+            size -= copied
+        self._filehandle.write(_read_at(src,offset,size))
+
+
+    def write_batch(self, msgs, workers: int=4):
+        """
+        Write a sequence of GRIB2 messages, packing them concurrently.
+
+        Messages are packed (encoded and compressed) on a thread pool --
+        the g2c packing routines release the GIL -- and the finished
+        message bytes are streamed to the file in the order the messages
+        were given, as each becomes ready.  This keeps the file writing
+        pipelined behind the packing instead of serializing all the
+        compression on one core.
+
+        Parameters
+        ----------
+        msgs
+            Sequence of GRIB2 message objects to write to file.
+        workers: default=4
+            Number of worker threads used to pack messages concurrently.
+        """
+        msgs = [m._materialize() if isinstance(m,Grib2MessageDeferred)
+                else m for m in msgs]
+        for m in msgs:
+            if not issubclass(m.__class__,_Grib2Message):
+                raise TypeError("msgs must be Grib2Message objects.")
+        if len(msgs) == 0:
+            return
+
+        def _pack(m):
+            if not hasattr(m,'_msg'):
+                if m._data is None and m._ondiskarray is not None:
+                    # Decode serialized; source file handles are shared.
+                    with _decode_lock:
+                        m.data
+                m.pack()
+
+        if workers <= 1:
+            for m in msgs:
+                _pack(m)
+                self._filehandle.write(m._msg)
+        else:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=workers) as pool:
+                futures = [pool.submit(_pack,m) for m in msgs]
+                for future,m in zip(futures,msgs):
+                    future.result()
+                    self._filehandle.write(m._msg)
+
+        self.flush()
+        self.size = os.path.getsize(self.name)
+        self._filehandle.seek(self.size-sum(m.section0[-1] for m in msgs))
+        self._build_index()
+
+
     def flush(self):
         """Flush the file object buffer."""
         self._filehandle.flush()
@@ -536,6 +1241,104 @@ class open():
         return list(sorted(set([msg.shortName for msg in self.select(level=level)])))
 
 
+def _prebuild_index(filename: str):
+    """Build and save the sidecar index file for one GRIB2 file."""
+    with open(filename, save_index=True):
+        pass
+
+
+def open_many(filenames, workers: int=4, **kwargs):
+    """
+    Open multiple GRIB2 files as a single Grib2Dataset.
+
+    Index construction is the dominant cost of opening many files, so the
+    sidecar index files are first built concurrently across a process pool
+    (one file per task); the files are then opened sequentially in the
+    parent, each loading its prebuilt index.  Prebuilt sidecar indexes
+    are also picked up by subsequent opens of the same files, including
+    through the xarray backend.
+
+    Parameters
+    ----------
+    filenames
+        Sequence of GRIB2 file names to open.
+    workers: default=4
+        Number of worker processes used to index files concurrently.
+    **kwargs
+        Additional keyword arguments passed to `grib2io.open` for each
+        file.
+
+    Returns
+    -------
+    open_many
+        Grib2Dataset object spanning the given files.
+    """
+    filenames = list(filenames)
+    local = [f for f in filenames if not is_remote_url(f)]
+    if workers > 1 and len(local) > 1:
+        with concurrent.futures.ProcessPoolExecutor(max_workers=workers) as pool:
+            list(pool.map(_prebuild_index, local))
+    return Grib2Dataset([open(f, **kwargs) for f in filenames])
+
+
+class Grib2Dataset:
+    """
+    A queryable view over the GRIB2 messages of multiple files.
+
+    Thin container around a list of `grib2io.open` objects, typically one
+    per forecast hour of a model cycle.  Iteration yields messages across
+    all files in file order, and `select` fans out to each file's hashed
+    attribute indexes and concatenates the results.
+    """
+    def __init__(self, files):
+        self.files = list(files)
+
+
+    def __enter__(self):
+        return self
+
+
+    def __exit__(self, atype, value, traceback):
+        self.close()
+
+
+    def __iter__(self):
+        for f in self.files:
+            yield from f
+
+
+    def __len__(self):
+        return sum(len(f) for f in self.files)
+
+
+    def __repr__(self):
+        return f"{self.__class__.__name__}({len(self.files)} files, {len(self)} messages)"
+
+
+    def close(self):
+        """Close all file handles."""
+        for f in self.files:
+            f.close()
+
+
+    def select(self, **kwargs):
+        """
+        Select GRIB2 messages by attribute across all files.
+
+        Accepts the same keyword arguments as `grib2io.open.select` and
+        uses each file's hashed attribute indexes.
+
+        Returns
+        -------
+        select
+            List of Grib2Message objects in file order.
+        """
+        msgs = []
+        for f in self.files:
+            msgs.extend(f.select(**kwargs))
+        return msgs
+
+
 class Grib2Message:
     """
     Creation class for a GRIB2 message.
@@ -721,11 +1524,7 @@ class _Grib2Message:
         self._ondiskarray = None
         self._orig_section5 = np.copy(self.section5)
         self._signature = self._generate_signature()
-        try:
-            self._sha1_section3 = hashlib.sha1(self.section3).hexdigest()
-        except(TypeError):
-            pass
-        self.bitMapFlag = templates.Grib2Metadata(self.bitMapFlag,table='6.0')
+        self.bitMapFlag = templates.Grib2Metadata.cached(self.bitMapFlag,table='6.0')
         self.bitmap = None
 
 
@@ -777,10 +1576,39 @@ class _Grib2Message:
         return ''.join([str(i) for i in self.section1[5:8]])
 
 
+    @property
+    def _sha1_section3(self):
+        """
+        Return the SHA1 hash of section 3.
+
+        The hash keys the process-wide lat/lon and griddef caches.  It is
+        recomputed on each access because assigning grid descriptor
+        attributes mutates section 3 in place after construction, and the
+        hash is cheap next to the coordinate math it guards.
+        """
+        return hashlib.sha1(self.section3).hexdigest()
+
+
+    def _latlon_cache_key(self, unrotate: bool):
+        """
+        Return the process-wide lat/lon cache key for this message's grid.
+
+        The key covers section 3, the grid point definition list (reduced
+        grids), and the unrotate setting.
+        """
+        key = self._sha1_section3
+        if self._deflist is not None and len(self._deflist) > 0:
+            key += hashlib.sha1(np.asarray(self._deflist)).hexdigest()
+        return (key, unrotate)
+
+
     @property
     def griddef(self):
         """Return a Grib2GridDef instance for a GRIB2 message."""
-        return Grib2GridDef.from_section3(self.section3)
+        if self._sha1_section3 not in _griddef_datastore.keys():
+            _griddef_datastore[self._sha1_section3] = \
+                Grib2GridDef.from_section3(self.section3)
+        return _griddef_datastore[self._sha1_section3]
 
 
     @property
@@ -904,9 +1732,19 @@ class _Grib2Message:
         It is the user's responsibility to populate the GRIB2 section
         information with appropriate metadata.
         """
+        t0 = time.monotonic()
+
         # Create beginning of packed binary message with section 0 and 1 data.
+        # The message buffer is pre-sized from the section 0 total length
+        # when known (messages previously packed or read from file), else
+        # from the field size, and grown in place as sections are added.
+        estimate = int(self.section0[-1])
+        if estimate <= 0:
+            estimate = 4*int(self.nx*self.ny)+4096
         self._sections = []
-        self._msg,self._pos = g2clib.grib2_create(self.indicatorSection[2:4],self.identificationSection)
+        self._msg,self._pos = g2clib.grib2_create(self.indicatorSection[2:4],
+                                                  self.identificationSection,
+                                                  size=estimate)
         self._sections += [0,1]
 
         # Add section 2 if present.
@@ -921,16 +1759,20 @@ class _Grib2Message:
                                                    self._deflist)
         self._sections.append(3)
 
-        # Prepare data.
+        # Prepare data.  A single dtype-converting copy of the data is made
+        # into a reusable per-thread scratch buffer; all further handling
+        # (scan-mode row flip, nan/missing replacement) is in place on it.
         if self._data is None:
             if self._ondiskarray is None:
                 raise ValueError("Grib2Message object has no data, thus it cannot be packed.")
-        field = np.copy(self.data)
+        data = self.data
+        fld = _pack_scratch(data.size)
+        fldgrid = fld.reshape(data.shape)
+        np.copyto(fldgrid,data,casting='unsafe')
         if self.scanModeFlags is not None:
             if self.scanModeFlags[3]:
-                fieldsave = field.astype('f') # Casting makes a copy
-                field[1::2,:] = fieldsave[1::2,::-1]
-        fld = field.astype('f')
+                # Overlapping slice assignment is buffered by numpy.
+                fldgrid[1::2,:] = fldgrid[1::2,::-1]
 
         # Prepare bitmap, if necessary
         bitmapflag = self.bitMapFlag.value
@@ -938,7 +1780,7 @@ class _Grib2Message:
             if self.bitmap is not None:
                 bmap = np.ravel(self.bitmap).astype(DEFAULT_NUMPY_INT)
             else:
-                bmap = np.ravel(np.where(np.isnan(fld),0,1)).astype(DEFAULT_NUMPY_INT)
+                bmap = np.ravel(np.where(np.isnan(fldgrid),0,1)).astype(DEFAULT_NUMPY_INT)
         else:
             bmap = None
 
@@ -949,18 +1791,19 @@ class _Grib2Message:
             crdlist = None
 
         # Prepare data for packing if nans are present
-        fld = np.ravel(fld)
         if bitmapflag in {0,254}:
-            fld = np.where(np.isnan(fld),0,fld)
+            np.copyto(fld,0,where=np.isnan(fld))
         else:
-            if np.isnan(fld).any():
+            nanmask = np.isnan(fld)
+            if nanmask.any():
                 if hasattr(self,'priMissingValue'):
-                    fld = np.where(np.isnan(fld),self.priMissingValue,fld)
+                    fld[nanmask] = self.priMissingValue
             if hasattr(self,'_missvalmap'):
+                missvalmap = np.ravel(self._missvalmap)
                 if hasattr(self,'priMissingValue'):
-                    fld = np.where(self._missvalmap==1,self.priMissingValue,fld)
+                    fld[missvalmap==1] = self.priMissingValue
                 if hasattr(self,'secMissingValue'):
-                    fld = np.where(self._missvalmap==2,self.secMissingValue,fld)
+                    fld[missvalmap==2] = self.secMissingValue
 
         # Add sections 4, 5, 6, and 7.
         self._msg,self._pos = g2clib.grib2_addfield(self._msg,self.pdtn,
@@ -981,6 +1824,9 @@ class _Grib2Message:
         self._sections.append(8)
         self.section0[-1] = len(self._msg)
 
+        _global_stats.fields_packed += 1
+        _global_stats.pack_seconds += time.monotonic()-t0
+
 
     @property
     def data(self) -> np.array:
@@ -988,6 +1834,11 @@ class _Grib2Message:
         if self._data is None:
             if self._auto_nans != _AUTO_NANS:
                 self._data = self._ondiskarray
+            if _DATA_CACHE_BUDGET > 0 and self._ondiskarray is not None:
+                # With a cache budget configured, decoded arrays live in
+                # the bounded library-level cache rather than being pinned
+                # on the message object.
+                return _data_cache_fetch(self._ondiskarray)
             self._data = np.asarray(self._ondiskarray)
         return self._data
 
@@ -997,6 +1848,106 @@ class _Grib2Message:
         if not isinstance(data, np.ndarray):
             raise ValueError('Grib2Message data only supports numpy arrays')
         self._data = data
+        # Assigned data supersedes the packed values on disk; dropping the
+        # on-disk reference ensures write() re-packs the message instead of
+        # copying the original bytes verbatim.
+        self._ondiskarray = None
+
+
+    def unpack(self, out=None):
+        """
+        Unpack the data values for this message from file.
+
+        Unlike the `data` property, the unpacked values are not cached on
+        the message, and a preallocated output buffer may be supplied and
+        reused across messages to eliminate the per-message array
+        allocations of repeated decoding.
+
+        Parameters
+        ----------
+        out: default=None
+            Optional preallocated, C-contiguous (ny,nx) numpy array
+            matching the message's data dtype that the unpacked values are
+            written into and returned.
+
+        Returns
+        -------
+        unpack
+            numpy.ndarray with shape (ny,nx) of unpacked data values; the
+            `out` array when one is given.
+        """
+        if self._ondiskarray is None:
+            raise ValueError("Grib2Message object has no data on disk.")
+        oda = self._ondiskarray
+        return _data(oda.filehandle, self, oda.bitmap_offset,
+                     oda.data_offset, out=out)
+
+
+    def data_window(self, j0: int, j1: int, i0: int, i1: int):
+        """
+        Unpack a spatial window of the data values.
+
+        For simple packing (DRT 5.0) on a regular grid without a bitmap,
+        only the byte span of the rows intersecting the window is read
+        from file and unpacked, so decode time and peak memory scale with
+        the window rather than the full grid.  All other packings fall
+        back to a full decode followed by slicing.
+
+        Parameters
+        ----------
+        j0, j1
+            Row (y) bounds of the window, half-open as in numpy slicing.
+        i0, i1
+            Column (x) bounds of the window, half-open as in numpy slicing.
+
+        Returns
+        -------
+        data_window
+            numpy.ndarray with shape (j1-j0,i1-i0) of data values.
+        """
+        ny, nx = self.ny, self.nx
+        if not (0 <= j0 < j1 <= ny and 0 <= i0 < i1 <= nx):
+            raise ValueError("Window bounds must be non-empty and within the grid.")
+
+        gds = self.section3[0:5]
+        reduced = gds[3] > 0 and gds[4] in {0,40} and self._deflist is not None
+        if self._ondiskarray is None or self.drtn != 0 or \
+        self.bitMapFlag in {0,254} or reduced or \
+        not hasattr(self,'scanModeFlags') or self.scanModeFlags[2]:
+            return np.ascontiguousarray(self.data[j0:j1,i0:i1])
+
+        oda = self._ondiskarray
+        drt = self._orig_section5[2:]
+        refval = utils.ieee_int_to_float(drt[0])
+        bscale = 2.0**drt[1]
+        dscale = 10.0**-drt[2]
+        nbits = int(drt[3])
+
+        if nbits == 0:
+            fld = np.full((j1-j0,i1-i0),refval*dscale,dtype=np.float32)
+        else:
+            # Read only the packed bit span covering rows j0:j1 and unpack
+            # the values with numpy.  Rows are unpacked whole so that the
+            # alternating-row scan mode can be applied before slicing the
+            # columns out.
+            nvals = (j1-j0)*nx
+            bit0 = j0*nx*nbits
+            byte0 = bit0//8
+            byte1 = -(-(bit0+nvals*nbits)//8)
+            raw = _read_at(oda.filehandle,oda.data_offset+5+byte0,byte1-byte0)
+            bits = np.unpackbits(np.frombuffer(raw,dtype=np.uint8))
+            bits = bits[bit0-byte0*8:bit0-byte0*8+nvals*nbits].reshape(nvals,nbits)
+            weights = (1 << np.arange(nbits-1,-1,-1)).astype(np.int64)
+            vals = bits.astype(np.int64) @ weights
+            fld = ((refval+vals*bscale)*dscale).astype(np.float32).reshape(j1-j0,nx)
+            if self.scanModeFlags[3]:
+                odd = (np.arange(j0,j1)%2) == 1
+                fld[odd,:] = fld[odd,::-1]
+            fld = np.ascontiguousarray(fld[:,i0:i1])
+
+        if self.typeOfValues == 1:
+            fld = fld.astype(np.int32)
+        return fld
 
 
     def flush_data(self):
@@ -1042,11 +1993,15 @@ class _Grib2Message:
         -------
         lats, lons : numpy.ndarray
             Returns two numpy.ndarrays with dtype=numpy.float32 of grid
-            latitudes and longitudes in units of degrees.
+            latitudes and longitudes in units of degrees.  The arrays are
+            shared, read-only views from a process-wide cache keyed on the
+            grid definition; messages on the same grid return the same
+            arrays.
         """
-        if self._sha1_section3 in _latlon_datastore.keys():
-            return (_latlon_datastore[self._sha1_section3]['latitude'],
-                    _latlon_datastore[self._sha1_section3]['longitude'])
+        cachekey = self._latlon_cache_key(unrotate)
+        if cachekey in _latlon_datastore.keys():
+            return (_latlon_datastore[cachekey]['latitude'],
+                    _latlon_datastore[cachekey]['longitude'])
         gdtn = self.gridDefinitionTemplateNumber.value
         gdtmpl = self.gridDefinitionTemplate
         reggrid = self.gridDefinitionSection[2] == 0 # This means regular 2-d grid
@@ -1181,9 +2136,17 @@ class _Grib2Message:
         else:
             raise ValueError('Unsupported grid')
 
-        _latlon_datastore[self._sha1_section3] = dict(latitude=lats,longitude=lons)
+        # Share the computed arrays process-wide; mark them read-only so
+        # one message cannot modify the grid under another.
+        lats = np.asarray(lats)
+        lons = np.asarray(lons)
+        lats.flags.writeable = False
+        lons.flags.writeable = False
+        _latlon_datastore[cachekey] = dict(latitude=lats,longitude=lons)
         try:
-            _latlon_datastore[self._sha1_section3]['vector_rotation_angles'] = rots
+            rots = np.asarray(rots)
+            rots.flags.writeable = False
+            _latlon_datastore[cachekey]['vector_rotation_angles'] = rots
         except(NameError):
             pass
 
@@ -1248,11 +2211,11 @@ class _Grib2Message:
         if hasattr(self,'_msg'):
             if validate:
                 if self.validate():
-                    return self._msg
+                    return bytes(self._msg)
                 else:
                     return None
             else:
-                return self._msg
+                return bytes(self._msg)
         else:
             return None
 
@@ -1355,6 +2318,77 @@ class _Grib2Message:
         return valid
 
 
+class Grib2MessageDeferred:
+    """
+    Deferred-decode proxy for a GRIB2 message.
+
+    Instances of this class are indexed in place of `Grib2Message` objects
+    when a file is opened with `lazy=True`.  The raw bytes of sections 1, 3,
+    4, and 5 are held as read during indexing and the g2c section unpacking
+    is deferred until the first attribute access, at which point a
+    fully-decoded `Grib2Message` object is built and all further attribute
+    access is delegated to it.
+    """
+    def __init__(self, section0, rawsec, section2, bmapflag, filehandle,
+                 nodata, msgnum, offset, bitmap_offset, data_offset):
+        self._section0 = section0
+        self._rawsec = rawsec
+        self._section2 = section2
+        self._bmapflag = bmapflag
+        self._filehandle = filehandle
+        self._nodata = nodata
+        self._msgnum = msgnum
+        self._offset = offset
+        self._bitmap_offset = bitmap_offset
+        self._data_offset = data_offset
+        self._decoded = None
+
+
+    def _materialize(self):
+        """Unpack the raw section bytes and build the Grib2Message object."""
+        if self._decoded is None:
+            section1, _ = g2clib.unpack1(self._rawsec[1],0,np.empty)
+            gds, gdt, deflist, _ = g2clib.unpack3(self._rawsec[3],0,np.empty)
+            section3 = np.concatenate((gds.tolist(),gdt.tolist()))
+            section3 = np.where(section3==4294967295,-1,section3)
+            numcoord, pdt, pdtnum, coordlist, _ = g2clib.unpack4(self._rawsec[4],0,np.empty)
+            section4 = np.concatenate((np.array((numcoord,pdtnum)),pdt.tolist()))
+            drt, drtn, npts, _ = g2clib.unpack5(self._rawsec[5],0,np.empty)
+            section5 = np.concatenate((np.array((npts,drtn)),drt))
+            section5 = np.where(section5==4294967295,-1,section5)
+            msg = Grib2Message(self._section0,section1,self._section2,
+                               section3,section4,section5,self._bmapflag)
+            msg._msgnum = self._msgnum
+            msg._deflist = deflist
+            msg._coordlist = coordlist
+            msg._isSubmessage = getattr(self,'_isSubmessage',False)
+            if not self._nodata:
+                msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
+                                                    TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
+                                                    self._filehandle,
+                                                    msg, self._offset,
+                                                    self._bitmap_offset,
+                                                    self._data_offset)
+            self._decoded = msg
+        return self._decoded
+
+
+    def __getattr__(self, name):
+        return getattr(self._materialize(), name)
+
+
+    def __repr__(self):
+        return repr(self._materialize())
+
+
+    def __str__(self):
+        return str(self._materialize())
+
+
+    def __getitem__(self, item):
+        return self._materialize()[item]
+
+
 @dataclass
 class Grib2MessageOnDiskArray:
     shape: str
@@ -1367,7 +2401,389 @@ class Grib2MessageOnDiskArray:
     data_offset: int
 
     def __array__(self, dtype=None):
-        return np.asarray(_data(self.filehandle, self.msg, self.bitmap_offset, self.data_offset),dtype=dtype)
+        return np.asarray(_data_cache_fetch(self),dtype=dtype)
+
+
+def _unpack_message_at(filename: str, offset: int):
+    """
+    Unpack the sections of a single GRIB2 message at a known byte offset.
+
+    This is the worker function for parallel indexing.  It opens its own
+    file handle so that it can be run in a worker process, and returns
+    plain picklable records -- one per message, with any submessages
+    flattened into additional records -- from which the index and
+    `Grib2Message` objects are assembled by the parent process.
+
+    Parameters
+    ----------
+    filename
+        File name containing GRIB2 messages.
+    offset
+        Byte offset to the beginning ("GRIB") of a GRIB2 message.
+
+    Returns
+    -------
+    _unpack_message_at
+        List of dicts, each containing the section offsets, section sizes,
+        message size, submessage flag, and unpacked section arrays for one
+        message.
+    """
+    with builtins.open(filename,'rb') as filehandle:
+        return _unpack_message(filehandle, offset)
+
+
+def _unpack_message(filehandle, offset: int):
+    """
+    Unpack the sections of a single GRIB2 message from a seekable file object.
+
+    Parameters
+    ----------
+    filehandle
+        Open file object positioned anywhere; it is seeked to `offset`.
+    offset
+        Byte offset to the beginning ("GRIB") of a GRIB2 message.
+
+    Returns
+    -------
+    _unpack_message
+        List of dicts, each containing the section offsets, section sizes,
+        message size, submessage flag, and unpacked section arrays for one
+        message.
+    """
+    records = []
+    filehandle.seek(offset)
+
+    bmapflag = None
+    section2 = b''
+    _secpos = dict.fromkeys(range(8))
+    _secsize = dict.fromkeys(range(8))
+    _isSubmessage = False
+
+    # Read Section 0 using struct.
+    _secpos[0] = offset
+    _secsize[0] = 16
+    header = struct.unpack(">I", filehandle.read(4))[0]
+    secmsg = filehandle.read(12)
+    section0 = np.concatenate(([header],list(struct.unpack('>HBBQ',secmsg))),dtype=np.int64)
+
+    # Read and unpack sections 1 through 8 which all follow a pattern of
+    # section size, number, and content.
+    while 1:
+        secmsg = filehandle.read(5)
+        secsize, secnum = struct.unpack('>iB',secmsg)
+
+        _secpos[secnum] = filehandle.tell()-5
+        _secsize[secnum] = secsize
+        if secnum in {1,3,4,5}:
+            secmsg += filehandle.read(secsize-5)
+        grbpos = 0
+
+        if secnum == 1:
+            section1, grbpos = g2clib.unpack1(secmsg,grbpos,np.empty)
+        elif secnum == 2:
+            section2 = filehandle.read(secsize-5)
+        elif secnum == 3:
+            gds, gdt, deflist, grbpos = g2clib.unpack3(secmsg,grbpos,np.empty)
+            gds = gds.tolist()
+            gdt = gdt.tolist()
+            section3 = np.concatenate((gds,gdt))
+            section3 = np.where(section3==4294967295,-1,section3)
+        elif secnum == 4:
+            numcoord, pdt, pdtnum, coordlist, grbpos = g2clib.unpack4(secmsg,grbpos,np.empty)
+            pdt = pdt.tolist()
+            section4 = np.concatenate((np.array((numcoord,pdtnum)),pdt))
+        elif secnum == 5:
+            drt, drtn, npts, _ = g2clib.unpack5(secmsg,grbpos,np.empty)
+            section5 = np.concatenate((np.array((npts,drtn)),drt))
+            section5 = np.where(section5==4294967295,-1,section5)
+        elif secnum == 6:
+            bmapflag = struct.unpack('>B',filehandle.read(1))[0]
+            filehandle.seek(filehandle.tell()+secsize-6)
+        elif secnum == 7:
+            filehandle.seek(filehandle.tell()+secsize-5)
+
+            records.append(dict(sectionOffset=copy.deepcopy(_secpos),
+                                sectionSize=copy.deepcopy(_secsize),
+                                msgSize=section0[-1],
+                                isSubmessage=_isSubmessage,
+                                sections=(section0,section1,section2,
+                                          section3,section4,section5,
+                                          bmapflag,deflist,coordlist)))
+
+            trailer = struct.unpack('>i',filehandle.read(4))[0]
+            if trailer.to_bytes(4, "big") == b'7777':
+                break
+            else:
+                nextsec = struct.unpack('>B',filehandle.read(1))[0]
+                if nextsec not in {2,3,4}:
+                    raise ValueError("Bad GRIB2 message structure.")
+                filehandle.seek(filehandle.tell()-5)
+                _isSubmessage = True
+                continue
+        else:
+            raise ValueError("Bad GRIB2 section number.")
+
+    return records
+
+
+def stream(fileobj):
+    """
+    Iterate over GRIB2 messages read from a binary stream.
+
+    This generator yields `Grib2Message` objects one at a time as complete
+    messages arrive on `fileobj`, buffering only the current message in
+    memory.  Unlike the `open` class, no seeking is performed on `fileobj`
+    and no whole-file index is built, so this works with pipes, sockets,
+    and other non-seekable sources.  Submessages are flattened and yielded
+    as individual messages; GRIB1 messages and non-GRIB content in the
+    stream are skipped.
+
+    Each yielded message holds its own in-memory copy of the message bytes,
+    so its data can be decoded after the stream has advanced.
+
+    Parameters
+    ----------
+    fileobj
+        Binary file object to read GRIB2 messages from.  Only its `read()`
+        method is used.
+
+    Yields
+    ------
+    stream
+        `Grib2Message` objects in the order they appear in the stream.
+    """
+    buffered = b''
+    msgnum = -1
+    while True:
+        # Locate the next "GRIB" identifier, reading more from the stream
+        # as needed.  Keep the last 3 bytes between reads in case the
+        # identifier straddles a read boundary.
+        ipos = buffered.find(b'GRIB')
+        if ipos == -1:
+            buffered = buffered[-3:]
+            chunk = fileobj.read(65536)
+            if not chunk:
+                return
+            buffered += chunk
+            continue
+        buffered = buffered[ipos:]
+
+        # Read Section 0 to get the GRIB edition and total message size.
+        while len(buffered) < 16:
+            chunk = fileobj.read(16-len(buffered))
+            if not chunk:
+                return
+            buffered += chunk
+        edition = buffered[7]
+        if edition == 1:
+            # Skip GRIB1 messages -- total size is bytes 5-7 of the message.
+            grib1_size = int.from_bytes(buffered[4:7],'big')
+            while len(buffered) < grib1_size:
+                chunk = fileobj.read(grib1_size-len(buffered))
+                if not chunk:
+                    return
+                buffered += chunk
+            buffered = buffered[grib1_size:]
+            continue
+        elif edition != 2:
+            buffered = buffered[4:]
+            continue
+        msgsize = int.from_bytes(buffered[8:16],'big')
+
+        # Read the remainder of the message, then parse its sections from
+        # an in-memory buffer.
+        while len(buffered) < msgsize:
+            chunk = fileobj.read(msgsize-len(buffered))
+            if not chunk:
+                return
+            buffered += chunk
+        msgbytes, buffered = buffered[:msgsize], buffered[msgsize:]
+        msgfh = io.BytesIO(msgbytes)
+        for rec in _unpack_message(msgfh, 0):
+            msgnum += 1
+            (section0,section1,section2,section3,
+             section4,section5,bmapflag,deflist,coordlist) = rec['sections']
+            msg = Grib2Message(section0,section1,section2,section3,
+                               section4,section5,bmapflag)
+            msg._msgnum = msgnum
+            msg._deflist = deflist
+            msg._coordlist = coordlist
+            msg._isSubmessage = rec['isSubmessage']
+            msg._ondiskarray = Grib2MessageOnDiskArray((msg.ny,msg.nx), 2,
+                                              TYPE_OF_VALUES_DTYPE[msg.typeOfValues],
+                                              msgfh,
+                                              msg, 0,
+                                              rec['sectionOffset'][6],
+                                              rec['sectionOffset'][7])
+            yield msg
+
+
+def _data_cache_fetch(oda):
+    """
+    Return the decoded data for an on-disk array, using the library-level
+    decoded-data cache when one is configured.
+
+    Cache keys cover the source file, message offsets, and the auto-nans
+    setting (which changes the decoded values).  On a hit the shared
+    cached array is returned; on a miss the message is decoded, cached,
+    and least-recently-used entries are evicted until the cache fits its
+    byte budget.
+
+    Parameters
+    ----------
+    oda
+        `Grib2MessageOnDiskArray` object to decode.
+
+    Returns
+    -------
+    _data_cache_fetch
+        numpy.ndarray of unpacked data values.
+    """
+    global _data_cache_bytes
+    if _DATA_CACHE_BUDGET <= 0:
+        return _data(oda.filehandle,oda.msg,oda.bitmap_offset,oda.data_offset)
+    key = (getattr(oda.filehandle,'name',id(oda.filehandle)),
+           oda.offset,oda.data_offset,_AUTO_NANS)
+    with _data_cache_lock:
+        if key in _data_cache:
+            _data_cache.move_to_end(key)
+            _global_stats.cache_hits += 1
+            st = _stats_by_handle.get(oda.filehandle)
+            if st is not None:
+                st.cache_hits += 1
+            return _data_cache[key]
+    _global_stats.cache_misses += 1
+    st = _stats_by_handle.get(oda.filehandle)
+    if st is not None:
+        st.cache_misses += 1
+    arr = _data(oda.filehandle,oda.msg,oda.bitmap_offset,oda.data_offset)
+    with _data_cache_lock:
+        if key not in _data_cache:
+            _data_cache[key] = arr
+            _data_cache_bytes += arr.nbytes
+        while _data_cache_bytes > _DATA_CACHE_BUDGET and len(_data_cache) > 1:
+            _,evicted = _data_cache.popitem(last=False)
+            _data_cache_bytes -= evicted.nbytes
+    return arr
+
+
+def set_data_cache(bytes: int=0):
+    """
+    Configure the library-level decoded-data cache.
+
+    When a nonzero byte budget is given, decoded data arrays are held in
+    a process-wide LRU cache consulted by `Grib2Message.data` and batch
+    decoding, instead of being pinned on each message object.  Memory
+    stays bounded by the budget -- least-recently-used arrays are evicted
+    while the cheap on-disk descriptors remain, so revisited messages are
+    served from cache and evicted ones are transparently re-decoded.
+    Cached arrays are shared between callers and should not be modified
+    in place.
+
+    Parameters
+    ----------
+    bytes
+        Byte budget for cached decoded arrays.  A value of 0 [DEFAULT]
+        disables the cache and drops any cached arrays.
+    """
+    global _DATA_CACHE_BUDGET, _data_cache_bytes
+    with _data_cache_lock:
+        _DATA_CACHE_BUDGET = int(bytes)
+        while _data_cache_bytes > _DATA_CACHE_BUDGET and len(_data_cache) > 0:
+            _,evicted = _data_cache.popitem(last=False)
+            _data_cache_bytes -= evicted.nbytes
+
+
+def get_stats() -> dict:
+    """
+    Return library-wide hot-path counters as a dictionary.
+
+    The counters aggregate over every file touched by the process: bytes
+    read and positioned reads (seeks), messages indexed, fields decoded
+    and packed, decoded-data cache hits and misses, and monotonic-clock
+    time spent indexing, decoding, and packing.  Per-file counters for an
+    open file are available from `open.stats`.
+
+    Returns
+    -------
+    get_stats
+        Dictionary of counter name to value.
+    """
+    return _global_stats._as_dict()
+
+
+def _read_at(filehandle, offset: int, size: int):
+    """
+    Read `size` bytes at absolute byte `offset` without moving the shared
+    file position.
+
+    Concurrent decodes from a thread pool share one file object per
+    `open` instance; pairing seek() and read() on it is racy.  Real files
+    are therefore read with os.pread on the underlying descriptor and
+    memory-mapped files by slicing the map, neither of which touch the
+    shared position.  File-like objects without a usable descriptor
+    (gzip, BytesIO, remote files) fall back to a lock-protected
+    seek/read.
+
+    Parameters
+    ----------
+    filehandle
+        File object to read from.
+    offset
+        Absolute byte offset to read at.
+    size
+        Number of bytes to read.
+
+    Returns
+    -------
+    _read_at
+        The bytes read.
+    """
+    _global_stats.bytes_read += size
+    _global_stats.seeks += 1
+    st = _stats_by_handle.get(filehandle)
+    if st is not None:
+        st.bytes_read += size
+        st.seeks += 1
+    if isinstance(filehandle,mmap.mmap):
+        return filehandle[offset:offset+size]
+    if filehandle.__class__.__module__ != 'gzip':
+        try:
+            fd = filehandle.fileno()
+        except(AttributeError,OSError,io.UnsupportedOperation):
+            fd = None
+        if fd is not None:
+            return os.pread(fd,size,offset)
+    with _decode_lock:
+        filehandle.seek(offset)
+        return filehandle.read(size)
+
+
+_pack_scratch_store = threading.local()
+
+def _pack_scratch(size: int):
+    """
+    Return a reusable float32 scratch array of `size` values.
+
+    The scratch buffer is per-thread (messages may be packed concurrently
+    by `open.write_batch`) and is only reallocated when a larger field is
+    packed, eliminating the per-message field copies of repeated packing.
+
+    Parameters
+    ----------
+    size
+        Number of float32 values required.
+
+    Returns
+    -------
+    _pack_scratch
+        1-D contiguous numpy.ndarray of dtype float32 and the given size.
+    """
+    buffer = getattr(_pack_scratch_store,'buffer',None)
+    if buffer is None or buffer.size < size:
+        buffer = np.empty(size,dtype=np.float32)
+        _pack_scratch_store.buffer = buffer
+    return buffer[:size]
 
 
 def _data(
@@ -1375,6 +2791,7 @@ def _data(
     msg: Grib2Message,
     bitmap_offset: Optional[int],
     data_offset: int,
+    out: Optional[NDArray]=None,
 )-> np.array:
     """
     Returns an unpacked data grid.
@@ -1389,6 +2806,12 @@ def _data(
         The offset to the beginning of the bitmap section.
     data_offset
         The offset to the beginning of the data section.
+    out
+        Optional preallocated, C-contiguous (ny,nx) array matching the
+        message's data dtype that the unpacked values are written into and
+        returned.  When the grid is regular and float32, the g2c unpacking
+        writes into the buffer directly, eliminating the per-message array
+        allocations.
 
     Returns
     -------
@@ -1397,10 +2820,12 @@ def _data(
         dtype=np.float32, but could be np.int32 if Grib2Message.typeOfValues is
         integer.
     """
+    t0 = time.monotonic()
     gds = msg.section3[0:5]
     gdt = msg.section3[5:]
     drt = msg._orig_section5[2:]
     nx, ny = msg.nx, msg.ny
+    reduced = gds[3] > 0 and gds[4] in {0,40} and msg._deflist is not None
 
     # Set the fill value according to how we are handling missing values
     msg._auto_nans = _AUTO_NANS
@@ -1412,14 +2837,12 @@ def _data(
         else:
             fill_value = np.nan
 
-    # Read bitmap data.
+    # Read bitmap data with a positioned read at the bitmap section.
     if bitmap_offset is not None:
-        # Position file pointer to the beginning of bitmap section.
-        filehandle.seek(bitmap_offset)
-        bmap_size,num = struct.unpack('>IB',filehandle.read(5))
-        filehandle.seek(filehandle.tell()-5)
+        bmap_size,num = struct.unpack('>IB',_read_at(filehandle,bitmap_offset,5))
         ipos = 0
-        bmap,bmapflag = g2clib.unpack6(filehandle.read(bmap_size),msg.section3[1],ipos,np.empty)
+        bmap,bmapflag = g2clib.unpack6(_read_at(filehandle,bitmap_offset,bmap_size),
+                                       msg.section3[1],ipos,np.empty)
         if bmap is not None:
             msg.bitmap = bmap.reshape((ny,nx)).astype(np.int8)
 
@@ -1427,60 +2850,105 @@ def _data(
         scanModeFlags = msg.scanModeFlags
         storageorder = 'F' if scanModeFlags[2] else 'C'
 
-    # Position file pointer to the beginning of data section.
-    filehandle.seek(data_offset)
-    data_size,secnum = struct.unpack('>IB',filehandle.read(5))
+    # Read the data section with a positioned read.
+    data_size,secnum = struct.unpack('>IB',_read_at(filehandle,data_offset,5))
     assert secnum == 7
-    filehandle.seek(filehandle.tell()-5)
     ipos = 0
     npvals = msg.numberOfPackedValues
     ngrdpts = msg.numberOfDataPoints
-    fld1 = g2clib.unpack7(filehandle.read(data_size),msg.gdtn,gdt,msg.drtn,drt,npvals,ipos,
-                          np.empty,storageorder=storageorder)
+
+    # A caller-supplied output buffer can receive the unpacked values
+    # directly when the grid is regular, float32, and not masked by a
+    # bitmap (the packed values then map 1:1 onto the grid points).
+    outflat = None
+    if out is not None:
+        if out.dtype == np.float32 and out.size == ngrdpts and \
+           out.flags['C_CONTIGUOUS'] and not reduced and \
+           msg.bitMapFlag not in {0,254}:
+            outflat = out.reshape(ngrdpts)
+    rawsec7 = _read_at(filehandle,data_offset,data_size)
+
+    # Complex packed fields (DRT 5.2/5.3) decode on the parallel
+    # group-level decoder when it was built; anything it does not handle
+    # (embedded missing values, Fortran storage order, a structurally
+    # surprising section) falls through to g2c.
+    fld1 = None
+    if cmplxunpack is not None and msg.drtn in {2,3} and drt[6] == 0 and \
+       storageorder == 'C':
+        try:
+            fld1 = cmplxunpack.unpack_complex(rawsec7,msg.drtn,drt,npvals)
+        except(ValueError):
+            fld1 = None
+    if fld1 is None:
+        fld1 = g2clib.unpack7(rawsec7,
+                              msg.gdtn,gdt,msg.drtn,drt,npvals,ipos,
+                              np.empty,storageorder=storageorder,out=outflat)
 
     # Handle the missing values
     if msg.bitMapFlag in {0,254}:
         # Bitmap
         fill_value = np.nan # If bitmap, use nans
-        fld = np.full((ngrdpts),fill_value,dtype=np.float32)
+        if out is not None and out.dtype == np.float32 and \
+           out.size == ngrdpts and out.flags['C_CONTIGUOUS'] and not reduced:
+            fld = out.reshape(ngrdpts)
+            fld.fill(fill_value)
+        else:
+            fld = np.full((ngrdpts),fill_value,dtype=np.float32)
         np.put(fld,np.nonzero(bmap),fld1)
     else:
-        # No bitmap, check missing values
+        # No bitmap, check missing values.  The masked assignments operate
+        # in place on the unpacked array.
         if hasattr(msg,'typeOfMissingValueManagement'):
             if msg.typeOfMissingValueManagement in {1,2}:
                 msg._missvalmap = np.zeros(fld1.shape,dtype=np.int8)
                 if hasattr(msg,'priMissingValue') and msg.priMissingValue is not None:
                     if msg._auto_nans: fill_value = np.nan
-                    msg._missvalmap = np.where(fld1==msg.priMissingValue,1,msg._missvalmap)
-                    fld1 = np.where(msg._missvalmap==1,fill_value,fld1)
+                    primask = fld1==msg.priMissingValue
+                    msg._missvalmap[primask] = 1
+                    fld1[primask] = fill_value
             if msg.typeOfMissingValueManagement == 2:
                 if hasattr(msg,'secMissingValue') and msg.secMissingValue is not None:
                     if msg._auto_nans: fill_value = np.nan
-                    msg._missvalmap = np.where(fld1==msg.secMissingValue,2,msg._missvalmap)
-                    fld1 = np.where(msg._missvalmap==2,fill_value,fld1)
+                    secmask = fld1==msg.secMissingValue
+                    msg._missvalmap[secmask] = 2
+                    fld1[secmask] = fill_value
         fld = fld1
 
     # Check for reduced grid.
-    if gds[3] > 0 and gds[4] in {0,40} and msg._deflist is not None:
+    if reduced:
         from . import redtoreg
         nx = 2*ny
         lonsperlat = msg._deflist
         fld = redtoreg._redtoreg(nx,lonsperlat.astype(np.int64),
-                                 fld.astype(np.float64),fill_value)
+                                 fld,fill_value)
     else:
         fld = np.reshape(fld,(ny,nx))
 
     # Check scan modes for rect grids.
     if nx is not None and ny is not None:
         if scanModeFlags[3]:
-            fldsave = fld.astype(np.float32) # casting makes a copy
-            fld[1::2,:] = fldsave[1::2,::-1]
+            # Overlapping slice assignment is safe; numpy buffers the
+            # source internally when source and destination overlap.
+            fld[1::2,:] = fld[1::2,::-1]
 
     # Default data type is np.float32. Convert to np.int32 according GRIB2
     # metadata attribute typeOfValues.
     if msg.typeOfValues == 1:
         fld = fld.astype(np.int32)
 
+    if out is not None:
+        if not np.shares_memory(fld,out):
+            out[...] = fld
+        fld = out
+
+    elapsed = time.monotonic()-t0
+    _global_stats.fields_decoded += 1
+    _global_stats.decode_seconds += elapsed
+    st = _stats_by_handle.get(filehandle)
+    if st is not None:
+        st.fields_decoded += 1
+        st.decode_seconds += elapsed
+
     return fld
 
 
@@ -1804,6 +3272,69 @@ def interpolate_to_stations(a, method, grid_def_in, lats, lons,
     return out
 
 
+def interpolate_to_stations_batch(msgs, method, lats, lons,
+                                  grid_def_in=None, method_options=None,
+                                  num_threads: int=1):
+    """
+    Batched interpolation to station points over a set of GRIB2 messages.
+
+    The entire batch is passed to NCEPLIBS-ip in a single call, so the
+    station interpolation weights are computed once for the shared input
+    grid instead of once per message, and the extraction runs across
+    OpenMP threads when available.  This is the preferred way to pull a
+    station time series from the message list returned by `open.select`.
+
+    Parameters
+    ----------
+    msgs
+        Sequence of `Grib2Message` objects, all on the same grid (e.g.
+        the list returned from `open.select`), or a numpy.ndarray of
+        shape (nmsgs,ny,nx), in which case `grid_def_in` must be given.
+    method
+        Interpolate method to use, as an integer or string accepted by
+        `grib2io.interpolate`.
+    lats : numpy.ndarray or list
+        Latitudes for station points.
+    lons : numpy.ndarray or list
+        Longitudes for station points.
+    grid_def_in : grib2io.Grib2GridDef, optional
+        Grib2GridDef object for the input grid.  Required when `msgs` is
+        a numpy.ndarray; ignored otherwise.
+    method_options : list of ints, optional
+        Interpolation options. See the NCEPLIBS-ip documentation for
+        more information on how these are used.
+    num_threads : int, optional
+        Number of OpenMP threads to use for interpolation.
+
+    Returns
+    -------
+    interpolate_to_stations_batch
+        numpy.ndarray of shape (nmsgs,nstations) of interpolated values.
+    """
+    if isinstance(msgs,np.ndarray):
+        if grid_def_in is None:
+            raise ValueError("grid_def_in is required when msgs is a numpy.ndarray.")
+        stack = msgs
+        if stack.ndim == 2:
+            stack = stack[np.newaxis,...]
+        if stack.ndim != 3:
+            raise ValueError("msgs array must have shape (nmsgs,ny,nx).")
+    else:
+        msgs = [m._materialize() if isinstance(m,Grib2MessageDeferred)
+                else m for m in msgs]
+        if len(msgs) == 0:
+            return np.array([],dtype=np.float32)
+        for m in msgs:
+            if m._sha1_section3 != msgs[0]._sha1_section3:
+                raise ValueError("All messages must be on the same grid.")
+        grid_def_in = msgs[0].griddef
+        stack = np.stack([m.data for m in msgs])
+    out = interpolate_to_stations(stack,method,grid_def_in,lats,lons,
+                                  method_options=method_options,
+                                  num_threads=num_threads)
+    return out.reshape(stack.shape[0],-1)
+
+
 @dataclass
 class Grib2GridDef:
     """
@@ -1837,6 +3368,139 @@ class Grib2GridDef:
         return (self.ny, self.nx)
 
 
+class InterpolationPlan:
+    """
+    Reusable interpolation plan between a fixed pair of grids.
+
+    A plan pins the interpolation method, options, and input/output grid
+    definitions so that regridding many fields between the same two grids
+    can be batched: `apply_batch` interpolates an entire (nmsgs,ny,nx)
+    stack with a single call into NCEPLIBS-ip, which computes the
+    interpolation weights once for the whole batch instead of once per
+    field.  Plans are cached process-wide and reused via the module-level
+    `interpolation_plan` function.
+    """
+    def __init__(self, method, grid_def_in, grid_def_out, method_options=None):
+        """
+        Initialize InterpolationPlan object instance.
+
+        Parameters
+        ----------
+        method
+            Interpolate method to use, as an integer or string accepted by
+            `grib2io.interpolate`.
+        grid_def_in : grib2io.Grib2GridDef
+            Grib2GridDef object for the input grid.
+        grid_def_out : grib2io.Grib2GridDef
+            Grib2GridDef object for the output grid.
+        method_options : list of ints, optional
+            Interpolation options. See the NCEPLIBS-ip documentation for
+            more information on how these are used.
+        """
+        if isinstance(method,str):
+            if method not in _interp_schemes.keys():
+                raise ValueError('Invalid interpolation method.')
+            method = _interp_schemes[method]
+        if method not in _interp_schemes.values():
+            raise ValueError('Invalid interpolation method.')
+        self.method = method
+        self.grid_def_in = grid_def_in
+        self.grid_def_out = grid_def_out
+        self.method_options = method_options
+
+
+    def apply(self, a, num_threads: int=1):
+        """
+        Interpolate a single field between the plan's grids.
+
+        Parameters
+        ----------
+        a : numpy.ndarray or tuple
+            Input data of shape (ny,nx), or a (u,v) tuple for vector
+            interpolation.
+        num_threads : int, optional
+            Number of OpenMP threads to use for interpolation.
+
+        Returns
+        -------
+        apply
+            Interpolated data on the plan's output grid.
+        """
+        return interpolate(a,self.method,self.grid_def_in,self.grid_def_out,
+                           method_options=self.method_options,
+                           num_threads=num_threads)
+
+
+    def apply_batch(self, stack, num_threads: int=1):
+        """
+        Interpolate a stack of fields between the plan's grids.
+
+        The whole stack is passed to NCEPLIBS-ip in a single call, so the
+        interpolation weights are computed once for the batch.
+
+        Parameters
+        ----------
+        stack : numpy.ndarray
+            Input data of shape (nmsgs,ny,nx) on the plan's input grid.
+        num_threads : int, optional
+            Number of OpenMP threads to use for interpolation.
+
+        Returns
+        -------
+        apply_batch
+            numpy.ndarray of shape (nmsgs,ny,nx) on the plan's output
+            grid.
+        """
+        stack = np.asarray(stack)
+        if stack.ndim == 2:
+            stack = stack[np.newaxis,...]
+        if stack.ndim != 3:
+            raise ValueError("stack must have shape (nmsgs,ny,nx).")
+        return interpolate(stack,self.method,self.grid_def_in,
+                           self.grid_def_out,
+                           method_options=self.method_options,
+                           num_threads=num_threads)
+
+
+_interp_plan_store = dict()
+
+def interpolation_plan(method, grid_def_in, grid_def_out,
+                       method_options=None):
+    """
+    Return a cached `InterpolationPlan` for the given grids and method.
+
+    Plans are keyed on the method, options, and both grid definitions, so
+    repeated regridding between the same two grids reuses one plan object.
+
+    Parameters
+    ----------
+    method
+        Interpolate method to use, as an integer or string accepted by
+        `grib2io.interpolate`.
+    grid_def_in : grib2io.Grib2GridDef
+        Grib2GridDef object for the input grid.
+    grid_def_out : grib2io.Grib2GridDef
+        Grib2GridDef object for the output grid.
+    method_options : list of ints, optional
+        Interpolation options. See the NCEPLIBS-ip documentation for
+        more information on how these are used.
+
+    Returns
+    -------
+    interpolation_plan
+        Shared `InterpolationPlan` instance.
+    """
+    key = (method if isinstance(method,str) else int(method),
+           int(grid_def_in.gdtn),np.asarray(grid_def_in.gdt).tobytes(),
+           int(grid_def_out.gdtn),np.asarray(grid_def_out.gdt).tobytes(),
+           None if method_options is None else tuple(method_options))
+    if key not in _interp_plan_store:
+        _interp_plan_store[key] = InterpolationPlan(method,grid_def_in,
+                                                    grid_def_out,
+                                                    method_options=method_options)
+    return _interp_plan_store[key]
+
+
 def _adjust_array_shape_for_interp(a, grid_def_in, grid_def_out):
     """
     Adjust shape of input data array for interpolation to grids.
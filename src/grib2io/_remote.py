@@ -0,0 +1,284 @@
+"""
+Remote file access for GRIB2 files over HTTP(S) and AWS S3.
+
+This module provides `RemoteFile`, a read-only, seekable, file-like object
+that fetches byte ranges on demand instead of downloading the whole file.
+It is used by `grib2io.open` when the file name is an `https://`, `http://`,
+or `s3://` URL.  Fetched ranges are cached in fixed-size blocks with an LRU
+eviction policy, adjacent uncached blocks are coalesced into a single range
+request, and `prefetch()` fetches a set of byte ranges concurrently ahead of
+data decoding.
+"""
+
+import collections
+import concurrent.futures
+import threading
+import urllib.parse
+import urllib.request
+
+DEFAULT_BLOCK_SIZE = 262144
+DEFAULT_MAX_BLOCKS = 512
+
+REMOTE_URL_SCHEMES = ('http', 'https', 's3')
+
+
+def is_remote_url(filename: str):
+    """
+    Return `True` if `filename` is a URL with a supported remote scheme.
+
+    Parameters
+    ----------
+    filename
+        File name or URL.
+
+    Returns
+    -------
+    is_remote_url
+        `True` for `http://`, `https://`, and `s3://` URLs; `False`
+        otherwise, including for path-like objects.
+    """
+    if not isinstance(filename, str):
+        return False
+    return urllib.parse.urlparse(filename).scheme in REMOTE_URL_SCHEMES
+
+
+class RemoteFile:
+    """
+    Read-only, seekable, file-like access to a remote GRIB2 file.
+
+    Bytes are fetched with range requests in fixed-size blocks and cached
+    with an LRU eviction policy, so repeated reads of the same section
+    headers or fields do not re-fetch from the remote store.  All methods
+    are thread-safe.
+
+    Attributes
+    ----------
+    name : str
+        The URL of the remote file.
+    size : int
+        Size of the remote file in units of bytes.
+    mtime : float
+        Last modification time of the remote file in seconds since the
+        epoch, or 0.0 when the remote store does not report one.
+    closed : bool
+        `True` if the file has been closed; `False` otherwise.
+    """
+    def __init__(self, url: str, blocksize: int=DEFAULT_BLOCK_SIZE,
+                 maxblocks: int=DEFAULT_MAX_BLOCKS):
+        """
+        Initialize RemoteFile object instance.
+
+        Parameters
+        ----------
+        url
+            URL of the remote GRIB2 file (`https://`, `http://`, or
+            `s3://bucket/key`).
+        blocksize: default=262144
+            Size in bytes of the cached fetch blocks.  Byte ranges are
+            rounded out to block boundaries and adjacent uncached blocks
+            are coalesced into a single range request.
+        maxblocks: default=512
+            Maximum number of blocks held in the cache before the least
+            recently used blocks are evicted.
+        """
+        parsed = urllib.parse.urlparse(url)
+        if parsed.scheme not in REMOTE_URL_SCHEMES:
+            raise ValueError(f"Unsupported remote URL scheme: {parsed.scheme}")
+        self.name = url
+        self.closed = False
+        self.mtime = 0.0
+        self._blocksize = blocksize
+        self._maxblocks = maxblocks
+        self._blocks = collections.OrderedDict()
+        self._lock = threading.Lock()
+        self._pos = 0
+        self._s3 = None
+        if parsed.scheme == 's3':
+            try:
+                import boto3
+                from botocore import UNSIGNED
+                from botocore.client import Config
+            except ImportError:
+                raise ImportError("boto3 is required to read GRIB2 files "
+                                  "from s3:// URLs.")
+            # Public buckets (e.g. the NOAA Open Data Dissemination
+            # buckets) are readable without AWS credentials, so fall back
+            # to unsigned requests when no credentials are resolvable.
+            session = boto3.session.Session()
+            if session.get_credentials() is None:
+                self._s3 = session.client('s3',
+                                          config=Config(signature_version=UNSIGNED))
+            else:
+                self._s3 = session.client('s3')
+            self._bucket = parsed.netloc
+            self._key = parsed.path.lstrip('/')
+            head = self._s3.head_object(Bucket=self._bucket, Key=self._key)
+            self.size = head['ContentLength']
+            if 'LastModified' in head:
+                self.mtime = head['LastModified'].timestamp()
+        else:
+            req = urllib.request.Request(url, method='HEAD')
+            with urllib.request.urlopen(req) as resp:
+                self.size = int(resp.headers['Content-Length'])
+                lastmod = resp.headers.get('Last-Modified')
+            if lastmod is not None:
+                import email.utils
+                self.mtime = email.utils.parsedate_to_datetime(lastmod).timestamp()
+
+
+    def _fetch(self, start: int, stop: int):
+        """
+        Fetch bytes [start,stop) from the remote file with one range request.
+        """
+        if self._s3 is not None:
+            resp = self._s3.get_object(Bucket=self._bucket, Key=self._key,
+                                       Range=f"bytes={start}-{stop-1}")
+            data = resp['Body'].read()
+        else:
+            req = urllib.request.Request(self.name)
+            req.add_header('Range', f"bytes={start}-{stop-1}")
+            with urllib.request.urlopen(req) as resp:
+                # A server or proxy that ignores the Range header answers
+                # 200 with the whole file; caching that as if it began at
+                # `start` would silently corrupt reads.
+                if resp.status != 206:
+                    raise OSError(f"Remote store ignored the range request "
+                                  f"(HTTP {resp.status}): {self.name}")
+                data = resp.read()
+        if len(data) != stop-start:
+            raise OSError(f"Short range read from {self.name}: expected "
+                          f"{stop-start} bytes, got {len(data)}.")
+        return data
+
+
+    def _missing_runs(self, firstblock: int, lastblock: int):
+        """
+        Return runs of uncached block numbers in [firstblock,lastblock] as
+        a list of (firstblock,lastblock) tuples, coalescing adjacent blocks
+        into single runs.
+        """
+        runs = []
+        n = firstblock
+        while n <= lastblock:
+            if n in self._blocks:
+                n += 1
+                continue
+            m = n
+            while m < lastblock and m+1 not in self._blocks:
+                m += 1
+            runs.append((n,m))
+            n = m+1
+        return runs
+
+
+    def _store(self, firstblock: int, data: bytes):
+        """Split fetched data into blocks and cache them, evicting via LRU."""
+        for i in range(0, len(data), self._blocksize):
+            self._blocks[firstblock+i//self._blocksize] = data[i:i+self._blocksize]
+            self._blocks.move_to_end(firstblock+i//self._blocksize)
+        while len(self._blocks) > self._maxblocks:
+            self._blocks.popitem(last=False)
+
+
+    def _ensure(self, start: int, stop: int):
+        """Fetch and cache any uncached blocks covering bytes [start,stop)."""
+        firstblock = start//self._blocksize
+        lastblock = (stop-1)//self._blocksize
+        for (b0,b1) in self._missing_runs(firstblock, lastblock):
+            data = self._fetch(b0*self._blocksize,
+                               min((b1+1)*self._blocksize, self.size))
+            self._store(b0, data)
+
+
+    def prefetch(self, ranges, workers: int=4):
+        """
+        Fetch and cache a set of byte ranges ahead of reading them.
+
+        Ranges rounding out to adjacent or overlapping blocks are coalesced
+        into single range requests, and the coalesced requests are issued
+        concurrently.
+
+        Parameters
+        ----------
+        ranges
+            Sequence of (start,stop) byte ranges, stop exclusive.
+        workers: default=4
+            Number of concurrent range requests.
+        """
+        with self._lock:
+            runs = set()
+            for (start,stop) in ranges:
+                if stop <= start:
+                    continue
+                stop = min(stop, self.size)
+                runs.update(self._missing_runs(start//self._blocksize,
+                                               (stop-1)//self._blocksize))
+            runs = sorted(runs)
+            if len(runs) == 0:
+                return
+            def _fetch_run(run):
+                return run[0], self._fetch(run[0]*self._blocksize,
+                                           min((run[1]+1)*self._blocksize,
+                                               self.size))
+            with concurrent.futures.ThreadPoolExecutor(max_workers=workers) as pool:
+                for (b0,data) in pool.map(_fetch_run, runs):
+                    self._store(b0, data)
+
+
+    def read(self, size: int=-1):
+        """
+        Read and return up to `size` bytes from the current position.
+
+        Parameters
+        ----------
+        size: default=-1
+            Number of bytes to read.  If negative, read to the end of the
+            file.
+        """
+        with self._lock:
+            if size is None or size < 0:
+                size = self.size-self._pos
+            size = min(size, self.size-self._pos)
+            if size <= 0:
+                return b''
+            start, stop = self._pos, self._pos+size
+            self._ensure(start, stop)
+            parts = []
+            for n in range(start//self._blocksize, (stop-1)//self._blocksize+1):
+                block = self._blocks[n]
+                self._blocks.move_to_end(n)
+                b0 = n*self._blocksize
+                parts.append(block[max(start-b0,0):stop-b0])
+            self._pos = stop
+            return b''.join(parts)
+
+
+    def seek(self, pos: int, whence: int=0):
+        """Set the position within the file in units of bytes."""
+        with self._lock:
+            if whence == 0:
+                self._pos = pos
+            elif whence == 1:
+                self._pos += pos
+            elif whence == 2:
+                self._pos = self.size+pos
+            return self._pos
+
+
+    def tell(self):
+        """Return the current position within the file in units of bytes."""
+        return self._pos
+
+
+    def close(self):
+        """Close the remote file, dropping all cached blocks."""
+        self._blocks.clear()
+        self.closed = True
+
+
+    def readable(self):
+        return True
+
+
+    def seekable(self):
+        return True
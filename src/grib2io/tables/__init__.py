@@ -1,20 +1,90 @@
 """Functions for retrieving data from NCEP GRIB2 Tables."""
 
 from functools import lru_cache
+from pathlib import Path
+import importlib
+import sys
 
 from typing import Optional, Union, List
 from numpy.typing import ArrayLike
 
-from .section0 import *
-from .section1 import *
-from .section3 import *
-from .section4 import *
-from .section5 import *
-from .section6 import *
-from .originating_centers import *
+# The code table modules are several thousand lines of dict literals and
+# dominate the package import time, so they are loaded lazily: the first
+# table lookup (or attribute access to a table_* name, via PEP 562 module
+# __getattr__) imports them and hoists their names into this namespace.
+_table_module_names = ('section0','section1','section3','section4',
+                       'section5','section6','originating_centers')
+_table_modules_loaded = False
+
+def _load_table_modules():
+    """Import the code table modules and hoist their names here."""
+    global _table_modules_loaded
+    if _table_modules_loaded:
+        return
+    for modname in _table_module_names:
+        mod = importlib.import_module(f'.{modname}',package=__name__)
+        names = getattr(mod,'__all__',None)
+        if names is None:
+            names = [n for n in vars(mod) if not n.startswith('_')]
+        for n in names:
+            globals().setdefault(n,getattr(mod,n))
+    _table_modules_loaded = True
+
+def __getattr__(name):
+    if not _table_modules_loaded and not name.startswith('__'):
+        _load_table_modules()
+        try:
+            return globals()[name]
+        except(KeyError):
+            pass
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
 
 GRIB2_DISCIPLINES = [0, 1, 2, 3, 4, 10, 20]
 
+# Bidirectional shortName maps built lazily on first use.  Both
+# directions cover every section4_discipline* table; shortName strings
+# are interned so repeated lookups and comparisons are identity-cheap.
+_varid_to_shortname = None
+_varid_to_shortname_ndfd = None
+_shortname_to_metadata = None
+
+def _build_shortname_maps():
+    """Build the shortName <-> (discipline, category, number) maps."""
+    global _varid_to_shortname, _varid_to_shortname_ndfd, _shortname_to_metadata
+    if _varid_to_shortname is not None:
+        return
+    varid = {}
+    varid_ndfd = {}
+    metadata = {}
+    modfiles = sorted(Path(__file__).parent.glob('section4_discipline*.py'),
+                      key=lambda p: int(p.stem[len('section4_discipline'):]))
+    for modfile in modfiles:
+        d = modfile.stem[len('section4_discipline'):]
+        mod = importlib.import_module(f'.{modfile.stem}',package=__name__)
+        for tblname,tbl in vars(mod).items():
+            if not tblname.startswith(f'table_4_2_{d}_'):
+                continue
+            isndfd = tblname.endswith('_ndfd')
+            pc = tblname[len(f'table_4_2_{d}_'):]
+            if isndfd:
+                pc = pc[:-len('_ndfd')]
+            for pn,varinfo in tbl.items():
+                if '-' in pn:
+                    continue
+                shortname = sys.intern(varinfo[2])
+                if isndfd:
+                    varid_ndfd[(d,pc,pn)] = shortname
+                else:
+                    varid[(d,pc,pn)] = shortname
+                    metadata.setdefault(shortname,[]).append(
+                        dict(discipline=int(d),parameterCategory=pc,
+                             parameterNumber=int(pn),fullName=varinfo[0],
+                             units=varinfo[1]))
+    _varid_to_shortname = varid
+    _varid_to_shortname_ndfd = varid_ndfd
+    _shortname_to_metadata = metadata
+
+@lru_cache(maxsize=None)
 def get_table(table: str, expand: bool=False) -> dict:
     """
     Return GRIB2 code table as a dictionary.
@@ -39,7 +109,10 @@ def get_table(table: str, expand: bool=False) -> dict:
     if len(table) == 3 and table.startswith('4.2'):
         raise Exception('Use function get_varinfo_from_table() for GRIB2 Code Table 4.2')
     try:
-        tbl = globals()['table_'+table.replace('.','_')]
+        tblname = 'table_'+table.replace('.','_')
+        if tblname not in globals():
+            _load_table_modules()
+        tbl = globals()[tblname]
         if expand:
             _tbl = {}
             for k,v in tbl.items():
@@ -55,6 +128,7 @@ def get_table(table: str, expand: bool=False) -> dict:
         return {}
 
 
+@lru_cache(maxsize=None)
 def get_value_from_table(
     value: Union[int, str],
     table: str,
@@ -90,6 +164,7 @@ def get_value_from_table(
         return None
 
 
+@lru_cache(maxsize=None)
 def get_varinfo_from_table(
     discipline: Union[int, str],
     parmcat: Union[int, str],
@@ -171,26 +246,14 @@ def get_shortnames(
     get_shortnames
         list of GRIB2 shortNames.
     """
-    shortnames = list()
-    if discipline is None:
-        discipline = GRIB2_DISCIPLINES
-    else:
-        discipline = [discipline]
-    if parmcat is None:
-        parmcat = list()
-        for d in discipline:
-            parmcat += list(get_table(f'4.1.{d}').keys())
-    else:
-        parmcat = [parmcat]
-    if parmnum is None:
-        parmnum = list(range(256))
-    else:
-        parmnum = [parmnum]
-    for d in discipline:
-
-        for pc in parmcat:
-            for pn in parmnum:
-                shortnames.append(get_varinfo_from_table(d,pc,pn,isNDFD)[2])
+    _build_shortname_maps()
+    varids = dict(_varid_to_shortname)
+    if isNDFD:
+        varids.update(_varid_to_shortname_ndfd)
+    shortnames = [sn for (d,pc,pn),sn in varids.items()
+                  if (discipline is None or d == str(discipline)) and
+                     (parmcat is None or pc == str(parmcat)) and
+                     (parmnum is None or pn == str(parmnum))]
 
     shortnames = sorted(set(shortnames))
     try:
@@ -220,16 +283,8 @@ def get_metadata_from_shortname(shortname: str):
         NOTE: Some variable shortNames will exist in multiple parameter
         category/number tables according to the GRIB2 discipline.
     """
-    metadata = []
-    for d in GRIB2_DISCIPLINES:
-        parmcat = list(get_table(f'4.1.{d}').keys())
-        for pc in parmcat:
-            for pn in range(256):
-                varinfo = get_varinfo_from_table(d,pc,pn,False)
-                if shortname == varinfo[2]:
-                    metadata.append(dict(discipline=d,parameterCategory=pc,parameterNumber=pn,
-                                         fullName=varinfo[0],units=varinfo[1]))
-    return metadata
+    _build_shortname_maps()
+    return list(_shortname_to_metadata.get(shortname,[]))
 
 
 def get_wgrib2_level_string(pdtn: int, pdt: ArrayLike) -> str:
@@ -59,10 +59,33 @@ class Grib2Metadata:
     definition : str
         Plain language description of numeric metadata.
     """
-    __slots__ = ('value','table')
+    __slots__ = ('value','table','_definition')
+    # Shared instances keyed on (value, table).  The descriptor classes
+    # build a Grib2Metadata on every attribute access; the code values
+    # come from a small fixed set of tables, so the instances (and their
+    # looked-up definitions) are memoized and reused across messages.
+    _store = {}
     def __init__(self, value, table=None):
-        self.value = value
-        self.table = table
+        object.__setattr__(self,'value',value)
+        object.__setattr__(self,'table',table)
+    def __setattr__(self, name, value):
+        # Instances are shared via cached(); mutating one would change the
+        # metadata seen by every message in the process.
+        raise AttributeError(f"{self.__class__.__name__} instances are immutable.")
+    def __delattr__(self, name):
+        raise AttributeError(f"{self.__class__.__name__} instances are immutable.")
+    def __reduce__(self):
+        return (self.__class__, (self.value, self.table))
+    @classmethod
+    def cached(cls, value, table=None):
+        """Return a shared, memoized instance for a (value, table) pair."""
+        key = (value if isinstance(value,str) else int(value), table)
+        try:
+            return cls._store[key]
+        except(KeyError):
+            meta = cls(value, table=table)
+            cls._store[key] = meta
+            return meta
     def __call__(self):
         return self.value
     def __hash__(self):
@@ -91,7 +114,12 @@ class Grib2Metadata:
         return int(self.value)
     @property
     def definition(self):
-        return tables.get_value_from_table(self.value,self.table)
+        try:
+            return self._definition
+        except(AttributeError):
+            object.__setattr__(self,'_definition',
+                               tables.get_value_from_table(self.value,self.table))
+            return self._definition
     def show_table(self):
         """Provide the table related to this metadata."""
         return tables.get_table(self.table)
@@ -111,7 +139,7 @@ class IndicatorSection:
 class Discipline:
     """[Discipline](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table0-0.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.indicatorSection[2],table='0.0')
+        return Grib2Metadata.cached(obj.indicatorSection[2],table='0.0')
     def __set__(self, obj, value):
         obj.section0[2] = value
 
@@ -131,35 +159,35 @@ class IdentificationSection:
 class OriginatingCenter:
     """[Originating Center](https://www.nco.ncep.noaa.gov/pmb/docs/on388/table0.html)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[0],table='originating_centers')
+        return Grib2Metadata.cached(obj.section1[0],table='originating_centers')
     def __set__(self, obj, value):
         obj.section1[0] = value
 
 class OriginatingSubCenter:
     """[Originating SubCenter](https://www.nco.ncep.noaa.gov/pmb/docs/on388/tablec.html)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[1],table='originating_subcenters')
+        return Grib2Metadata.cached(obj.section1[1],table='originating_subcenters')
     def __set__(self, obj, value):
         obj.section1[1] = value
 
 class MasterTableInfo:
     """[GRIB2 Master Table Version](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table1-0.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[2],table='1.0')
+        return Grib2Metadata.cached(obj.section1[2],table='1.0')
     def __set__(self, obj, value):
         obj.section1[2] = value
 
 class LocalTableInfo:
     """[GRIB2 Local Tables Version Number](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table1-1.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[3],table='1.1')
+        return Grib2Metadata.cached(obj.section1[3],table='1.1')
     def __set__(self, obj, value):
         obj.section1[3] = value
 
 class SignificanceOfReferenceTime:
     """[Significance of Reference Time](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table1-2.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[4],table='1.2')
+        return Grib2Metadata.cached(obj.section1[4],table='1.2')
     def __set__(self, obj, value):
         obj.section1[4] = value
 
@@ -229,14 +257,14 @@ class RefDate:
 class ProductionStatus:
     """[Production Status of Processed Data](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table1-3.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[11],table='1.3')
+        return Grib2Metadata.cached(obj.section1[11],table='1.3')
     def __set__(self, obj, value):
         obj.section1[11] = value
 
 class TypeOfData:
     """[Type of Processed Data in this GRIB message](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table1-4.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section1[12],table='1.4')
+        return Grib2Metadata.cached(obj.section1[12],table='1.4')
     def __set__(self, obj, value):
         obj.section1[12] = value
 
@@ -259,7 +287,7 @@ class GridDefinitionSection:
 class SourceOfGridDefinition:
     """[Source of Grid Definition](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table3-0.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section3[0],table='3.0')
+        return Grib2Metadata.cached(obj.section3[0],table='3.0')
     def __set__(self, obj, value):
         raise RuntimeError
 
@@ -273,14 +301,14 @@ class NumberOfDataPoints:
 class InterpretationOfListOfNumbers:
     """Interpretation of List of Numbers"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section3[3],table='3.11')
+        return Grib2Metadata.cached(obj.section3[3],table='3.11')
     def __set__(self, obj, value):
         raise RuntimeError
 
 class GridDefinitionTemplateNumber:
     """[Grid Definition Template Number](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table3-1.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section3[4],table='3.1')
+        return Grib2Metadata.cached(obj.section3[4],table='3.1')
     def __set__(self, obj, value):
         raise RuntimeError
 
@@ -356,7 +384,7 @@ class XYDivisor:
 class ShapeOfEarth:
     """[Shape of the Reference System](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table3-2.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section3[5],table='3.2')
+        return Grib2Metadata.cached(obj.section3[5],table='3.2')
     def __set__(self, obj, value):
         obj.section3[5] = value
 
@@ -882,7 +910,7 @@ def gdt_class_by_gdtn(gdtn: int):
 class ProductDefinitionTemplateNumber:
     """[Product Definition Template Number](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table4-0.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[1],table='4.0')
+        return Grib2Metadata.cached(obj.section4[1],table='4.0')
     def __set__(self, obj, value):
         raise RuntimeError
 
@@ -948,7 +976,7 @@ class TypeOfGeneratingProcess:
     _key = defaultdict(lambda: 2, {48:13})
     #_key = {0:2, 1:2, 2:2, 5:2, 6:2, 8:2, 9:2, 10:2, 11:2, 12:2, 15:2, 48:13}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.3')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.3')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -966,7 +994,7 @@ class GeneratingProcess:
     _key = defaultdict(lambda: 4, {48:15})
     #_key = {0:4, 1:4, 2:4, 5:4, 6:4, 8:4, 9:4, 10:4, 11:4, 12:4, 15:4, 48:15}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='generating_process')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='generating_process')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -991,7 +1019,7 @@ class UnitOfForecastTime:
     _key = defaultdict(lambda: 7, {48:18})
     #_key = {0:7, 1:7, 2:7, 5:7, 6:7, 8:7, 9:7, 10:7, 11:7, 12:7, 15:7, 48:18}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.4')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.4')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -1088,7 +1116,7 @@ class TypeOfFirstFixedSurface:
     _key = defaultdict(lambda: 9, {48:20})
     #_key = {0:9, 1:9, 2:9, 5:9, 6:9, 8:9, 9:9, 10:9, 11:9, 12:9, 15:9, 48:20}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.5')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.5')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -1133,7 +1161,7 @@ class TypeOfSecondFixedSurface:
     _key = defaultdict(lambda: 12, {48:23})
     #_key = {0:12, 1:12, 2:12, 5:12, 6:12, 8:12, 9:12, 10:12, 11:12, 12:12, 15:12, 48:23}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.5')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.5')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -1185,7 +1213,7 @@ class TypeOfEnsembleForecast:
     _key = {1:15, 11:15}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.6')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.6')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1215,7 +1243,7 @@ class TypeOfDerivedForecast:
     _key = {2:15, 12:15}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.7')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.7')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1245,7 +1273,7 @@ class TypeOfProbability:
     _key = {5:17, 9:17}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.9')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.9')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1438,7 +1466,7 @@ class StatisticalProcess:
     _key = {8:23, 9:30, 10:24, 11:26, 12:25, 15:15}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.10')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.10')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1448,7 +1476,7 @@ class TypeOfTimeIncrementOfStatisticalProcess:
     _key = {8:24, 9:31, 10:25, 11:27, 12:26}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.11')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.11')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1458,7 +1486,7 @@ class UnitOfTimeRangeOfStatisticalProcess:
     _key = {8:25, 9:32, 10:26, 11:28, 12:27}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.4')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.4')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1478,7 +1506,7 @@ class UnitOfTimeRangeOfSuccessiveFields:
     _key = {8:27, 9:34, 10:28, 11:30, 12:29}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.4')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.4')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1498,7 +1526,7 @@ class TypeOfStatisticalProcessing:
     _key = {15:16}
     def __get__(self, obj, objtype=None):
         pdtn = obj.section4[1]
-        return Grib2Metadata(obj.section4[self._key[pdtn]+2],table='4.15')
+        return Grib2Metadata.cached(obj.section4[self._key[pdtn]+2],table='4.15')
     def __set__(self, obj, value):
         pdtn = obj.section4[1]
         obj.section4[self._key[pdtn]+2] = value
@@ -1572,7 +1600,7 @@ class TypeOfAerosol:
     """[Type of Aerosol](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table4-233.shtml)"""
     _key = {48:2}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.233')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.233')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -1580,7 +1608,7 @@ class TypeOfIntervalForAerosolSize:
     """[Type of Interval for Aerosol Size](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table4-91.shtml)"""
     _key = {48:3}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.91')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.91')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -1620,7 +1648,7 @@ class TypeOfIntervalForAerosolWavelength:
     """[Type of Interval for Aerosol Wavelength](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table4-91.shtml)"""
     _key = {48:8}
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section4[self._key[obj.pdtn]+2],table='4.91')
+        return Grib2Metadata.cached(obj.section4[self._key[obj.pdtn]+2],table='4.91')
     def __set__(self, obj, value):
         obj.section4[self._key[obj.pdtn]+2] = value
 
@@ -2024,7 +2052,7 @@ class NumberOfPackedValues:
 class DataRepresentationTemplateNumber:
     """[Data Representation Template Number](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-0.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[1],table='5.0')
+        return Grib2Metadata.cached(obj.section5[1],table='5.0')
     def __set__(self, obj, value):
         pass
 
@@ -2066,21 +2094,21 @@ class NBitsPacking:
 class TypeOfValues:
     """[Type of Original Field Values](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-1.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[4+2],table='5.1')
+        return Grib2Metadata.cached(obj.section5[4+2],table='5.1')
     def __set__(self, obj, value):
         obj.section5[4+2] = value
 
 class GroupSplittingMethod:
     """[Group Splitting Method](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-4.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[5+2],table='5.4')
+        return Grib2Metadata.cached(obj.section5[5+2],table='5.4')
     def __set__(self, obj, value):
         obj.section5[5+2] = value
 
 class TypeOfMissingValueManagement:
     """[Type of Missing Value Management](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-5.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[6+2],table='5.5')
+        return Grib2Metadata.cached(obj.section5[6+2],table='5.5')
     def __set__(self, obj, value):
         obj.section5[6+2] = value
 
@@ -2164,7 +2192,7 @@ class NBitsScaledGroupLength:
 class SpatialDifferenceOrder:
     """[Spatial Difference Order](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-6.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[16+2],table='5.6')
+        return Grib2Metadata.cached(obj.section5[16+2],table='5.6')
     def __set__(self, obj, value):
         obj.section5[16+2] = value
 
@@ -2178,14 +2206,14 @@ class NBytesSpatialDifference:
 class Precision:
     """[Precision for IEEE Floating Point Data](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-7.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[0+2],table='5.7')
+        return Grib2Metadata.cached(obj.section5[0+2],table='5.7')
     def __set__(self, obj, value):
         obj.section5[0+2] = value
 
 class TypeOfCompression:
     """[Type of Compression](https://www.nco.ncep.noaa.gov/pmb/docs/grib2/grib2_doc/grib2_table5-40.shtml)"""
     def __get__(self, obj, objtype=None):
-        return Grib2Metadata(obj.section5[5+2],table='5.40')
+        return Grib2Metadata.cached(obj.section5[5+2],table='5.40')
     def __set__(self, obj, value):
         obj.section5[5+2] = value
 
@@ -7,6 +7,8 @@ from copy import copy
 from dataclasses import dataclass, field, astuple
 import itertools
 import logging
+import os
+import threading
 import typing
 
 import numpy as np
@@ -17,15 +19,34 @@ from xarray.backends import (
     BackendEntrypoint,
 )
 from xarray.core import indexing
-from xarray.backends.locks import SerializableLock
 
 import grib2io
-from grib2io import Grib2Message, Grib2GridDef
+from grib2io import Grib2Message, Grib2GridDef, tables
 from grib2io._grib2io import _data
+from grib2io.templates import Grib2Metadata
 
 logger = logging.getLogger(__name__)
 
-LOCK = SerializableLock()
+_filehandle_cache = {}
+_filehandle_lock = threading.Lock()
+
+
+def _get_filehandle(file_name):
+    """
+    Return a cached read-only filehandle for file_name.
+
+    Handles are cached per process so that dask tasks deserialized onto a
+    worker share a single open file instead of re-opening it for every
+    chunk.  All reads go through grib2io's positioned-read decode path, so
+    one handle can be shared by many threads without locking.
+    """
+    key = (os.getpid(), file_name)
+    with _filehandle_lock:
+        fh = _filehandle_cache.get(key)
+        if fh is None or fh.closed:
+            fh = open(file_name, mode='rb')
+            _filehandle_cache[key] = fh
+        return fh
 
 
 class GribBackendEntrypoint(BackendEntrypoint):
@@ -96,7 +117,7 @@ class GribBackendEntrypoint(BackendEntrypoint):
 
 class GribBackendArray(BackendArray):
 
-    def __init__(self, array, lock):
+    def __init__(self, array, lock=None):
         self.array = array
         self.shape = array.shape
         self.dtype = np.dtype(array.dtype)
@@ -113,6 +134,10 @@ class GribBackendArray(BackendArray):
 
     def _raw_getitem(self, key: tuple):
         """Implement thread safe access to data on disk."""
+        # the decode path uses positioned reads on a shared handle, so no
+        # lock is needed unless one is provided
+        if self.lock is None:
+            return self.array[key]
         with self.lock:
             return self.array[key]
 
@@ -297,16 +322,16 @@ class OnDiskArray:
 
         array_field = np.full(array_field_shape, fill_value=np.nan, dtype="float32")
 
-        with open(self.file_name, mode='rb') as filehandle:
-            for key, row in index.iterrows():
+        filehandle = _get_filehandle(self.file_name)
+        for key, row in index.iterrows():
 
-                bitmap_offset = None if pd.isna(row['sectionOffset'][6]) else int(row['sectionOffset'][6])
-                values = _data(filehandle, row.msg, bitmap_offset, row['sectionOffset'][7])
+            bitmap_offset = None if pd.isna(row['sectionOffset'][6]) else int(row['sectionOffset'][6])
+            values = _data(filehandle, row.msg, bitmap_offset, row['sectionOffset'][7])
 
-                if len(index_slicer_inclusive) >= 1:
-                    array_field[row.miloc] = values
-                else:
-                    array_field = values
+            if len(index_slicer_inclusive) >= 1:
+                array_field[row.miloc] = values
+            else:
+                array_field = values
 
         # handle geo dim slicing
         array_field = array_field[(Ellipsis,) + item[-self.geo_ndim :]]
@@ -356,11 +381,77 @@ def filter_index(index, k, v):
     return index
 
 
+# end-of-period date and duration positions within the product definition
+# template for the statistical-processing templates; positions follow the
+# descriptor _key tables in templates.py
+_enddate_pdt_key = {8:slice(15,21), 9:slice(22,28), 10:slice(16,22), 11:slice(18,24), 12:slice(17,23)}
+_duration_pdt_key = {8:25, 9:32, 10:26, 11:28, 12:27}
+
+
+def _pdt_column(msgs, pdtn, default, special=None):
+    """
+    Gather one product definition template value per message.
+
+    default is the template position used for all product definition
+    template numbers except those overridden in special (+2 converts a
+    template position to a section4 position).
+    """
+    n = len(msgs)
+    if special:
+        pos = [special.get(int(p), default) + 2 for p in pdtn]
+    else:
+        pos = itertools.repeat(default + 2, n)
+    return np.fromiter((m.section4[i] for m, i in zip(msgs, pos)), dtype=np.int64, count=n)
+
+
+def _metadata_column(values, table):
+    """Wrap integer code values in Grib2Metadata, one instance per unique value."""
+    lookup = {v: Grib2Metadata(v, table=table) for v in np.unique(values)}
+    return np.array([lookup[v] for v in values], dtype=object)
+
+
+def _scale_time_hours(units):
+    """Map time unit codes to hours, one table lookup per unique code."""
+    lookup = {int(u): tables.get_value_from_table(int(u), 'scale_time_hours') for u in np.unique(units)}
+    return np.array([lookup[int(u)] for u in units], dtype=np.float64)
+
+
+def _leadtime_column(msgs, pdtn, refdate):
+    """
+    Compute the forecast lead time for every message.
+
+    Vectorized equivalent of utils.get_leadtime: the statistical
+    templates (pdtn 8-12) difference the end-of-period date against the
+    reference date; all others scale the forecast time value to hours.
+    """
+    leadtime = np.empty(len(msgs), dtype='timedelta64[ns]')
+    for p in np.unique(pdtn):
+        rows = np.nonzero(pdtn == p)[0]
+        if int(p) in _enddate_pdt_key:
+            s = _enddate_pdt_key[int(p)]
+            parts = np.array([msgs[i].section4[s.start+2:s.stop+2] for i in rows])
+            end = pd.to_datetime(dict(year=parts[:,0], month=parts[:,1],
+                                      day=parts[:,2], hour=parts[:,3],
+                                      minute=parts[:,4], second=parts[:,5])).to_numpy()
+            leadtime[rows] = end - refdate[rows]
+        else:
+            uidx, vidx = (20, 21) if int(p) == 48 else (9, 10)
+            units = np.fromiter((msgs[i].section4[uidx] for i in rows), dtype=np.int64, count=len(rows))
+            values = np.fromiter((msgs[i].section4[vidx] for i in rows), dtype=np.float64, count=len(rows))
+            leadtime[rows] = pd.to_timedelta(values*_scale_time_hours(units), unit='h').to_numpy()
+    return leadtime
+
+
 def parse_grib_index(index, filters):
     """
     Apply filters.
 
     Evaluate remaining dimensions based on pdtn and parse each out.
+
+    Metadata columns are extracted column-wise from the stacked raw
+    section arrays rather than by touching template descriptor
+    attributes message by message; table lookups happen once per unique
+    value, which keeps open_dataset fast on files with many messages.
     """
 
     # make a copy of filters, remove filters as they are applied
@@ -374,13 +465,29 @@ def parse_grib_index(index, filters):
         # allowed to filter to nothing to make empty dataset
         index = filter_index(index, k, v)
 
-    # expand index
-    index = index.assign(shortName=index.msg.apply(lambda msg: msg.shortName))
-    index = index.assign(nx=index.msg.apply(lambda msg: msg.nx))
-    index = index.assign(ny=index.msg.apply(lambda msg: msg.ny))
-    index = index.assign(typeOfGeneratingProcess=index.msg.apply(lambda msg: msg.typeOfGeneratingProcess))
-    index = index.assign(productDefinitionTemplateNumber=index.msg.apply(lambda msg: msg.productDefinitionTemplateNumber))
-    index = index.assign(typeOfFirstFixedSurface=index.msg.apply(lambda msg: msg.typeOfFirstFixedSurface))
+    # expand index column-wise from the raw section arrays
+    msgs = index.msg.to_numpy()
+    n = len(msgs)
+    pdtn_col = np.fromiter((m.section4[1] for m in msgs), dtype=np.int64, count=n)
+
+    # variable info is looked up once per unique (discipline, parameter
+    # category, parameter number) triple
+    varids = np.column_stack((
+        np.fromiter((m.section0[2] for m in msgs), dtype=np.int64, count=n),
+        _pdt_column(msgs, pdtn_col, 0),
+        _pdt_column(msgs, pdtn_col, 1),
+        np.fromiter((m._isNDFD for m in msgs), dtype=np.int64, count=n)))
+    uniqids, inverse = np.unique(varids, axis=0, return_inverse=True)
+    shortnames = np.array([tables.get_varinfo_from_table(d, c, p, isNDFD=bool(f))[2]
+                           for d, c, p, f in uniqids], dtype=object)
+    index = index.assign(shortName=shortnames[inverse])
+    index = index.assign(nx=np.fromiter((m.section3[12] for m in msgs), dtype=np.int64, count=n))
+    index = index.assign(ny=np.fromiter((m.section3[13] for m in msgs), dtype=np.int64, count=n))
+    index = index.assign(typeOfGeneratingProcess=_metadata_column(
+        _pdt_column(msgs, pdtn_col, 2, {48:13}), '4.3'))
+    index = index.assign(productDefinitionTemplateNumber=_metadata_column(pdtn_col, '4.0'))
+    index = index.assign(typeOfFirstFixedSurface=_metadata_column(
+        _pdt_column(msgs, pdtn_col, 9, {48:20}), '4.5'))
     index = index.astype({'ny':'int','nx':'int'})
     # apply common filters(to all definition templates) to reduce dataset to
     # single cube
@@ -411,7 +518,10 @@ def parse_grib_index(index, filters):
     # refDate always added for now (could add only based on
     # typOfGeneratingProcess)
     if 'refDate' not in index.columns:
-        index = index.assign(refDate=index.msg.apply(lambda msg: msg.refDate))
+        s1 = np.array([m.section1 for m in msgs])
+        index = index.assign(refDate=pd.to_datetime(dict(
+            year=s1[:,5], month=s1[:,6], day=s1[:,7], hour=s1[:,8],
+            minute=s1[:,9], second=s1[:,10])).to_numpy())
     @dataclass(init=False)
     class RefDateDim:
         refDate: pd.Index = PdIndex()
@@ -420,14 +530,17 @@ def parse_grib_index(index, filters):
     # leadTime always added for now (could add only based on
     # typOfGeneratingProcess)
     if 'leadTime' not in index.columns:
-        index = index.assign(leadTime=index.msg.apply(lambda msg: msg.leadTime))
+        index = index.assign(leadTime=_leadtime_column(
+            msgs, pdtn_col, pd.to_datetime(index['refDate']).to_numpy()))
     @dataclass(init=False)
     class LeadTimeDim:
         leadTime: pd.Index = PdIndex()
     non_geo_dims.append(LeadTimeDim)
 
     if 'valueOfFirstFixedSurface' not in index.columns:
-        index = index.assign(valueOfFirstFixedSurface=index.msg.apply(lambda msg: msg.valueOfFirstFixedSurface))
+        scale_factor = _pdt_column(msgs, pdtn_col, 10, {48:21})
+        scaled_value = _pdt_column(msgs, pdtn_col, 11, {48:22})
+        index = index.assign(valueOfFirstFixedSurface=scaled_value/np.power(10., scale_factor))
     @dataclass(init=False)
     class ValueOfFirstFixedSurfaceDim:
         valueOfFirstFixedSurface: pd.Index = PdIndex()
@@ -439,8 +552,16 @@ def parse_grib_index(index, filters):
         # Probability forecasts at a horizontal level or in a horizontal layer
         # in a continuous or non-continuous time interval.  (see Template
         # 4.9)
-        index = index.assign(thresholdLowerLimit = index.msg.apply(lambda msg: msg.thresholdLowerLimit))
-        index = index.assign(thresholdUpperLimit = index.msg.apply(lambda msg: msg.thresholdUpperLimit))
+        scale_factor = _pdt_column(msgs, pdtn_col, 18)
+        scaled_value = _pdt_column(msgs, pdtn_col, 19)
+        index = index.assign(thresholdLowerLimit=np.where(
+            (scale_factor == -127) & (scaled_value == 255),
+            0.0, scaled_value/np.power(10., scale_factor.astype(np.float64))))
+        scale_factor = _pdt_column(msgs, pdtn_col, 20)
+        scaled_value = _pdt_column(msgs, pdtn_col, 21)
+        index = index.assign(thresholdUpperLimit=np.where(
+            (scale_factor == -127) & (scaled_value == 255),
+            0.0, scaled_value/np.power(10., scale_factor.astype(np.float64))))
 
         if index['thresholdLowerLimit'].nunique() > 1:
             @dataclass(init=False)
@@ -457,7 +578,7 @@ def parse_grib_index(index, filters):
         # Percentile forecasts at a horizontal level or in a horizontal layer
         # in a continuous or non-continuous time interval.  (see Template
         # 4.10)
-        index = index.assign(percentileValue = index.msg.apply(lambda msg: msg.percentileValue))
+        index = index.assign(percentileValue=_pdt_column(msgs, pdtn_col, 15))
 
         @dataclass(init=False)
         class PercentileValueDim:
@@ -466,7 +587,13 @@ def parse_grib_index(index, filters):
 
     if pdtn in {8,9,10,11,12,13,14,42,43,45,46,47,61,62,63,67,68,72,73,78,79,82,83,84,85,87,91}:
         if 'duration' not in index.columns:
-            index = index.assign(duration=index.msg.apply(lambda msg: msg.duration))
+            key = _duration_pdt_key.get(int(pdtn))
+            if key is None:
+                duration = np.zeros(n, dtype='timedelta64[ns]')
+            else:
+                hours = _pdt_column(msgs, pdtn_col, key+1)*_scale_time_hours(_pdt_column(msgs, pdtn_col, key))
+                duration = pd.to_timedelta(hours, unit='h').to_numpy()
+            index = index.assign(duration=duration)
 
         @dataclass(init=False)
         class Duration:
@@ -475,7 +602,7 @@ def parse_grib_index(index, filters):
 
     if pdtn in {1,11,33,34,41,43,45,47,49,54,56,58,59,63,68,77,79,81,83,84,85,92}:
         if 'perturbationNumber' not in index.columns:
-            index = index.assign(perturbationNumber = index.msg.apply(lambda msg: msg.perturbationNumber))
+            index = index.assign(perturbationNumber=_pdt_column(msgs, pdtn_col, 16))
         @dataclass(init=False)
         class perturbationNumber:
             perturbationNumber: pd.Index = PdIndex()
@@ -507,8 +634,7 @@ def build_da_without_coords(index, cube, filename) -> xr.DataArray:
     dims = {k: len(cube[k]) for k in dim_names}
 
     data = OnDiskArray(filename, index, cube)
-    lock = LOCK
-    data = GribBackendArray(data, lock)
+    data = GribBackendArray(data)
     data = indexing.LazilyIndexedArray(data)
     if len(dim_names) != len(data.shape):
         raise ValueError(
@@ -522,7 +648,13 @@ def build_da_without_coords(index, cube, filename) -> xr.DataArray:
 
     da.encoding['original_shape'] = data.shape
 
-    da.encoding['preferred_chunks'] = {'y':-1, 'x':-1}
+    # one chunk per grib2 message (the natural decode unit): chunk each
+    # non-geo dimension singly and keep the y,x grid whole so dask tasks
+    # map one-to-one onto messages
+    preferred_chunks = {k: 1 for k in dim_names}
+    preferred_chunks['y'] = -1
+    preferred_chunks['x'] = -1
+    da.encoding['preferred_chunks'] = preferred_chunks
     msg1 = index.msg.iloc[0]
 
     # plain language metadata is minimized
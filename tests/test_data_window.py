@@ -0,0 +1,40 @@
+import numpy as np
+from numpy.testing import assert_allclose, assert_array_equal
+
+import grib2io
+
+
+def test_data_window_simple_packing(tmp_path, request):
+    """The partial-decode fast path must match a full-decode slice."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    outfile = tmp_path / 'simple.grib2'
+
+    # Repack the first bundled message with simple packing (DRT 5.0),
+    # which is the template the data_window() fast path decodes.
+    with grib2io.open(gfile) as f:
+        src = f[0]
+        section5 = np.array([src.section5[0], 0, 0, 0, 2, 0, 0],
+                            dtype=np.int64)
+        msg = grib2io.Grib2Message(src.section0.copy(), src.section1.copy(),
+                                   src.section2, src.section3.copy(),
+                                   src.section4.copy(), section5, 255)
+        msg.data = src.data.copy()
+        with grib2io.open(outfile, mode='w') as g:
+            g.write(msg)
+
+    with grib2io.open(outfile) as g:
+        m = g[0]
+        assert int(m.drtn) == 0
+        win = m.data_window(5, 25, 10, 40)
+        assert win.shape == (20, 30)
+        assert_allclose(win, m.data[5:25, 10:40], rtol=1e-6)
+
+
+def test_data_window_fallback(request):
+    """Other packings fall back to a full decode followed by slicing."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs.complex.grib2'
+    with grib2io.open(gfile) as f:
+        m = f[0]
+        assert int(m.drtn) != 0
+        win = m.data_window(0, 10, 0, 10)
+        assert_array_equal(win, m.data[0:10, 0:10])
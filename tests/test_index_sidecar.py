@@ -0,0 +1,55 @@
+import shutil
+
+import pytest
+from numpy.testing import assert_allclose, assert_array_equal
+
+import grib2io
+
+
+def _copy_subset(tmp_path, request):
+    src = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    dst = tmp_path / 'gfs_subset.grib2'
+    shutil.copy(src, dst)
+    return dst
+
+
+def test_sidecar_roundtrip(tmp_path, request):
+    """An index loaded from a sidecar must match a fresh indexing scan."""
+    gfile = _copy_subset(tmp_path, request)
+    with grib2io.open(gfile, save_index=True) as f:
+        nmsgs = len(f)
+        ref_attrs = [(m.shortName, m.level) for m in f]
+        ref_sections = [(m.section1, m.section3, m.section4, m.section5) for m in f]
+        ref_data = f[0].data.copy()
+    assert (tmp_path / (gfile.name + '.g2idx')).exists()
+
+    with grib2io.open(gfile) as f:
+        assert len(f) == nmsgs
+        assert [(m.shortName, m.level) for m in f] == ref_attrs
+        for m, sections in zip(f, ref_sections):
+            assert_array_equal(m.section1, sections[0])
+            assert_array_equal(m.section3, sections[1])
+            assert_array_equal(m.section4, sections[2])
+            assert_array_equal(m.section5, sections[3])
+        assert_allclose(f[0].data, ref_data)
+
+
+def test_sidecar_stale_invalidation(tmp_path, request):
+    """A sidecar whose stored size/mtime no longer match is ignored."""
+    gfile = _copy_subset(tmp_path, request)
+    with grib2io.open(gfile, save_index=True) as f:
+        nmsgs = len(f)
+    raw = gfile.read_bytes()
+    gfile.write_bytes(raw + raw)
+    with grib2io.open(gfile) as f:
+        assert len(f) == 2 * nmsgs
+
+
+def test_sidecar_corrupt_ignored(tmp_path, request):
+    """A corrupt or planted sidecar falls back to a full indexing scan."""
+    gfile = _copy_subset(tmp_path, request)
+    with grib2io.open(gfile, save_index=True) as f:
+        nmsgs = len(f)
+    (tmp_path / (gfile.name + '.g2idx')).write_bytes(b'not an index file')
+    with grib2io.open(gfile) as f:
+        assert len(f) == nmsgs
@@ -0,0 +1,22 @@
+import pytest
+from numpy.testing import assert_allclose, assert_array_equal
+
+import grib2io
+
+
+@pytest.mark.parametrize('kwargs', [dict(lazy=True), dict(mmap=True)],
+                         ids=['lazy', 'mmap'])
+def test_mode_parity(request, kwargs):
+    """Lazy and mmap opens must be indistinguishable from an eager open."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    with grib2io.open(gfile) as ref, grib2io.open(gfile, **kwargs) as f:
+        assert len(f) == len(ref)
+        for mref, m in zip(ref, f):
+            assert m.shortName == mref.shortName
+            assert m.level == mref.level
+            assert_array_equal(m.section1, mref.section1)
+            assert_array_equal(m.section3, mref.section3)
+            assert_array_equal(m.section4, mref.section4)
+            assert_array_equal(m.section5, mref.section5)
+        assert_allclose(f[0].data, ref[0].data)
+        assert_allclose(f[-1].data, ref[-1].data)
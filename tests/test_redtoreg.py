@@ -0,0 +1,47 @@
+import numpy as np
+import pytest
+from numpy.testing import assert_array_equal
+
+redtoreg = pytest.importorskip('grib2io.redtoreg')
+
+
+def test_redtoreg_linear_and_empty_row():
+    """Linear interpolation, exact columns, and a zero-lons latitude."""
+    lonsperlat = np.array([2, 4, 0], dtype=np.int64)
+    red = np.array([10, 20, 1, 2, 3, 4], dtype=np.float32)
+    reg = redtoreg._redtoreg(4, lonsperlat, red, 9999.0)
+    # Row 0 doubles 2 points to 4 with wraparound; row 1 maps 1:1; row 2
+    # has no data points and fills with the missing value.
+    expected = np.array([[10.0, 15.0, 20.0, 15.0],
+                         [1.0, 2.0, 3.0, 4.0],
+                         [9999.0, 9999.0, 9999.0, 9999.0]], dtype=np.float32)
+    assert reg.dtype == np.float32
+    assert_array_equal(reg, expected)
+
+
+def test_redtoreg_nearest_neighbor_around_nan():
+    """A NaN neighbor (bitmapped point) switches to nearest neighbor."""
+    lonsperlat = np.array([4], dtype=np.int64)
+    red = np.array([1.0, np.nan, 3.0, 4.0], dtype=np.float32)
+    reg = redtoreg._redtoreg(8, lonsperlat, red, 9999.0)
+    expected = np.array([[1.0, np.nan, np.nan, 3.0,
+                          3.0, 3.5, 4.0, 2.5]], dtype=np.float32)
+    assert_array_equal(reg, expected)
+
+
+def test_redtoreg_nearest_neighbor_around_missval():
+    """A sentinel-valued neighbor is handled like a NaN one."""
+    lonsperlat = np.array([4], dtype=np.int64)
+    red = np.array([1.0, 9999.0, 3.0, 4.0], dtype=np.float32)
+    reg = redtoreg._redtoreg(8, lonsperlat, red, 9999.0)
+    expected = np.array([[1.0, 9999.0, 9999.0, 3.0,
+                          3.0, 3.5, 4.0, 2.5]], dtype=np.float32)
+    assert_array_equal(reg, expected)
+
+
+def test_redtoreg_size_mismatch():
+    """The reduced grid must hold exactly sum(lonsperlat) values."""
+    with pytest.raises(ValueError):
+        redtoreg._redtoreg(4, np.array([2, 2], dtype=np.int64),
+                           np.array([1.0, 2.0, 3.0], dtype=np.float32),
+                           9999.0)
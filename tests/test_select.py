@@ -0,0 +1,35 @@
+import grib2io
+
+
+def _scan(f, **kwargs):
+    """Reference selection by scanning every message."""
+    out = []
+    for m in f:
+        ok = True
+        for k, v in kwargs.items():
+            values = v if isinstance(v, (list, tuple, set)) else [v]
+            if not hasattr(m, k) or getattr(m, k) not in values:
+                ok = False
+                break
+        if ok:
+            out.append(m._msgnum)
+    return out
+
+
+def test_select_matches_scan(request):
+    """Indexed select() must return exactly what a full scan returns."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    with grib2io.open(gfile) as f:
+        shortname = f[0].shortName
+        level = f[0].level
+        other = f[-1].shortName
+        cases = [
+            dict(shortName=shortname),
+            dict(shortName=shortname, level=level),
+            dict(shortName=[shortname, other]),
+            dict(productDefinitionTemplateNumber=int(f[0].pdtn)),
+        ]
+        for kwargs in cases:
+            got = [m._msgnum for m in f.select(**kwargs)]
+            assert got == _scan(f, **kwargs)
+            assert len(got) > 0
@@ -0,0 +1,21 @@
+import io
+
+from numpy.testing import assert_allclose
+
+import grib2io
+
+
+def test_stream_matches_open(request):
+    """stream() over a BytesIO must yield the same messages as open()."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    with grib2io.open(gfile) as f:
+        ref = [(m.shortName, m.level, m.section4.tolist()) for m in f]
+        ref_data = f[0].data.copy()
+    with open(gfile, 'rb') as fo:
+        raw = fo.read()
+
+    msgs = list(grib2io.stream(io.BytesIO(raw)))
+    assert [(m.shortName, m.level, m.section4.tolist()) for m in msgs] == ref
+    # Streamed messages carry their own copy of the message bytes, so
+    # data decodes after the stream has been consumed.
+    assert_allclose(msgs[0].data, ref_data)
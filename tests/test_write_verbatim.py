@@ -0,0 +1,44 @@
+import numpy as np
+from numpy.testing import assert_allclose
+
+import grib2io
+
+
+def test_write_verbatim_bytes(tmp_path, request):
+    """Unmodified messages written with write() must be byte-identical."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    outfile = tmp_path / 'copy.grib2'
+    with open(gfile, 'rb') as fo:
+        raw = fo.read()
+
+    with grib2io.open(gfile) as f:
+        with grib2io.open(outfile, mode='w') as g:
+            for m in f:
+                g.write(m)
+        expected = b''.join(
+            raw[offs[0]:offs[0]+int(size)]
+            for offs, size in zip(f._index['sectionOffset'],
+                                  f._index['msgSize']))
+    assert outfile.read_bytes() == expected
+
+    # The copy must re-open and decode identically to the source.
+    with grib2io.open(gfile) as f, grib2io.open(outfile) as g:
+        assert len(g) == len(f)
+        assert [m.shortName for m in g] == [m.shortName for m in f]
+        assert_allclose(g[0].data, f[0].data)
+
+
+def test_write_modified_data_repacks(tmp_path, request):
+    """Assigning new data must force a re-pack, never a verbatim copy."""
+    gfile = request.config.rootdir / 'tests' / 'data' / 'gfs_20221107' / 'gfs.t00z.pgrb2.1p00.f012_subset'
+    outfile = tmp_path / 'modified.grib2'
+    with grib2io.open(gfile) as f:
+        msg = f[0]
+        newdata = (msg.data + 5.0).astype(np.float32)
+        msg.data = newdata
+        with grib2io.open(outfile, mode='w') as g:
+            g.write(msg)
+
+    with grib2io.open(outfile) as g:
+        assert_allclose(g[0].data, newdata, rtol=1e-4)
+